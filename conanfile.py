@@ -29,6 +29,7 @@ class RotorConan(ConanFile):
         "enable_fltk" : [True, False],
         "enable_thread": [True, False],
         "multithreading": [True, False],  # enables multithreading support
+        "hybrid_refcount": [True, False],  # non-atomic refcount for not shared messages
     }
     default_options = {
         "fPIC": True,
@@ -38,6 +39,7 @@ class RotorConan(ConanFile):
         "enable_fltk" : False,
         "enable_thread": True,
         "multithreading": True,
+        "hybrid_refcount": False,
     }
 
     def config_options(self):
@@ -69,6 +71,7 @@ class RotorConan(ConanFile):
         tc.variables["ROTOR_BUILD_FLTK"] = self.options.enable_fltk
         tc.variables["ROTOR_BUILD_EXAMPLES"] = os.environ.get('ROTOR_ROTOR_BUILD_EXAMPLES', 'OFF')
         tc.variables["ROTOR_BUILD_THREAD_UNSAFE"] = not self.options.multithreading
+        tc.variables["ROTOR_HYBRID_REFCOUNT"] = self.options.hybrid_refcount
         tc.variables["ROTOR_BUILD_TESTS"] = not self.conf.get("tools.build:skip_test", default=True, check_type=bool)
         tc.generate()
         tc = CMakeDeps(self)
@@ -127,6 +130,8 @@ class RotorConan(ConanFile):
 
         if not self.options.multithreading:
             self.cpp_info.components["core"].defines.append("ROTOR_BUILD_THREAD_UNSAFE")
+        elif self.options.hybrid_refcount:
+            self.cpp_info.components["core"].defines.append("ROTOR_REFCOUNT_HYBRID")
 
         if self.options.enable_asio:
             self.cpp_info.components["asio"].libs = ["rotor_asio"]
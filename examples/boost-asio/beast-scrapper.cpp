@@ -241,7 +241,7 @@ struct resolver_worker_t : public r::actor_base_t {
 
     explicit resolver_worker_t(config_t &config)
         : r::actor_base_t{config}, io_timeout{config.resolve_timeout},
-          strand{static_cast<ra::supervisor_asio_t *>(config.supervisor)->get_strand()}, backend{strand.context()} {}
+          backend{static_cast<ra::supervisor_asio_t *>(config.supervisor)->get_io_executor()} {}
 
     void configure(r::plugin::plugin_base_t &plugin) noexcept override {
         r::actor_base_t::configure(plugin);
@@ -392,7 +392,6 @@ struct resolver_worker_t : public r::actor_base_t {
 
     std::optional<r::request_id_t> timer_request;
     pt::time_duration io_timeout;
-    asio::io_context::strand &strand;
     tcp::resolver backend;
     request_ptr_t request;
     Queue queue;
@@ -409,7 +408,7 @@ struct http_worker_t : public r::actor_base_t {
 
     explicit http_worker_t(config_t &config)
         : r::actor_base_t{config}, resolve_timeout(config.resolve_timeout), request_timeout(config.request_timeout),
-          strand{static_cast<ra::supervisor_asio_t *>(config.supervisor)->get_strand()} {}
+          io_executor{static_cast<ra::supervisor_asio_t *>(config.supervisor)->get_io_executor()} {}
 
     void configure(r::plugin::plugin_base_t &plugin) noexcept override {
         r::actor_base_t::configure(plugin);
@@ -483,7 +482,7 @@ struct http_worker_t : public r::actor_base_t {
         }
 
         sys::error_code ec_sock;
-        sock = std::make_unique<tcp::socket>(strand.context());
+        sock = std::make_unique<tcp::socket>(io_executor);
         sock->open(tcp::v4(), ec_sock);
         if (ec_sock) {
             make_response(make_error(ec_sock));
@@ -578,7 +577,7 @@ struct http_worker_t : public r::actor_base_t {
     std::optional<r::request_id_t> resolve_request;
     pt::time_duration resolve_timeout;
     pt::time_duration request_timeout;
-    asio::io_context::strand &strand;
+    ra::supervisor_asio_t::executor_t io_executor;
     r::address_ptr_t resolver;
     request_ptr_t orig_req;
     r::message_ptr_t response;
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * This is a multi-producer (fan-in) benchmark: several plain threads
+ * concurrently enqueue messages to the single consumer actor, which
+ * runs on the thread backend. It measures how fast the consumer
+ * receives all the messages, i.e. how much the producers contend on
+ * the consumer's inbound queue and its wake-up machinery.
+ *
+ * Usage: fan-in [producers] [messages per producer] [poll_us]
+ */
+
+#include "rotor.hpp"
+#include "rotor/thread.hpp"
+#include <boost/lexical_cast.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace r = rotor;
+namespace rth = rotor::thread;
+
+using bench_clock_t = std::chrono::high_resolution_clock;
+
+namespace payload {
+struct data_t {
+    std::uint32_t producer;
+};
+} // namespace payload
+
+namespace message {
+using data_t = r::message_t<payload::data_t>;
+} // namespace message
+
+struct consumer_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::uint64_t expected = 0;
+    bench_clock_t::time_point start;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&consumer_t::on_data); });
+    }
+
+    void on_data(message::data_t &) noexcept {
+        if (++received == expected) {
+            std::chrono::duration<double> diff = bench_clock_t::now() - start;
+            double freq = ((double)received) / diff.count();
+            std::cout << "received " << received << " messages in " << std::fixed << std::setprecision(6)
+                      << diff.count() << "s, freq = " << std::setprecision(2) << freq << "\n";
+            do_shutdown();
+        }
+    }
+
+  private:
+    std::uint64_t received = 0;
+};
+
+int main(int argc, char **argv) {
+    try {
+        using boost::conversion::try_lexical_convert;
+        std::uint32_t producers = 4;
+        std::uint32_t count = 100000;
+        std::uint32_t poll_us = 0;
+        if (argc > 1) {
+            try_lexical_convert(argv[1], producers);
+            if (argc > 2) {
+                try_lexical_convert(argv[2], count);
+                if (argc > 3) {
+                    try_lexical_convert(argv[3], poll_us);
+                }
+            }
+        }
+        std::cout << "producers = " << producers << ", messages per producer = " << count
+                  << ", poll = " << poll_us << "us\n";
+
+        rth::system_context_thread_t ctx;
+        auto timeout = boost::posix_time::milliseconds{100};
+        auto sup = ctx.create_supervisor<rth::supervisor_thread_t>()
+                       .poll_duration(r::pt::microseconds{poll_us})
+                       .timeout(timeout)
+                       .finish();
+        auto consumer = sup->create_actor<consumer_t>().autoshutdown_supervisor().timeout(timeout).finish();
+        consumer->expected = std::uint64_t{producers} * count;
+        auto &address = consumer->get_address();
+
+        // let the consumer start
+        sup->do_process();
+
+        consumer->start = bench_clock_t::now();
+        std::vector<std::thread> threads;
+        for (std::uint32_t i = 0; i < producers; ++i) {
+            threads.emplace_back([&, i]() {
+                for (std::uint32_t j = 0; j < count; ++j) {
+                    sup->enqueue(r::make_message<payload::data_t>(address, payload::data_t{i}));
+                }
+            });
+        }
+        ctx.run();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    } catch (const std::exception &ex) {
+        std::cout << "exception : " << ex.what();
+    }
+
+    return 0;
+}
@@ -116,10 +116,14 @@ int main(int argc, char **argv) {
         using boost::conversion::try_lexical_convert;
         std::uint32_t count = 10000;
         std::uint32_t poll_us = 100;
+        bool intrusive = false;
         if (argc > 1) {
             try_lexical_convert(argv[1], count);
             if (argc > 2) {
                 try_lexical_convert(argv[2], poll_us);
+                if (argc > 3) {
+                    try_lexical_convert(argv[3], intrusive);
+                }
             }
         }
 
@@ -128,6 +132,7 @@ int main(int argc, char **argv) {
         auto timeout = boost::posix_time::milliseconds{100};
         auto sup_ping = ctx_ping.create_supervisor<rth::supervisor_thread_t>()
                 .poll_duration(r::pt::milliseconds{poll_us})
+                .intrusive_inbound_queue(intrusive)
                 .timeout(timeout)
                 .create_registry()
                 .finish();
@@ -136,6 +141,7 @@ int main(int argc, char **argv) {
 
         auto sup_pong = ctx_pong.create_supervisor<rth::supervisor_thread_t>()
                             .poll_duration(r::pt::milliseconds{poll_us})
+                            .intrusive_inbound_queue(intrusive)
                             .timeout(timeout)
                             .registry_address(sup_ping->get_registry_address())
                             .finish();
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * This is a benchmark of the supervisor messages queue. It compares the
+ * "raw" push/pop throughput of `std::deque` and `rotor::messages_queue_t`
+ * (ring buffer), and then measures single-thread ping-pong: with a message
+ * allocation per ping/pong and without any allocations (message redirection).
+ *
+ * Usage: queue-bench [count] [burst]
+ */
+
+#include "rotor.hpp"
+#include "rotor/thread.hpp"
+#include <boost/lexical_cast.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+
+namespace r = rotor;
+namespace rth = rotor::thread;
+
+using bench_clock_t = std::chrono::high_resolution_clock;
+
+namespace payload {
+struct data_t {
+    std::uint64_t counter;
+};
+} // namespace payload
+
+namespace message {
+using data_t = r::message_t<payload::data_t>;
+} // namespace message
+
+static void report(const char *name, std::uint64_t count, bench_clock_t::time_point start) {
+    std::chrono::duration<double> diff = bench_clock_t::now() - start;
+    double freq = ((double)count) / diff.count();
+    std::cout << std::setw(24) << std::left << name << ": " << count << " messages in " << std::fixed
+              << std::setprecision(6) << diff.count() << "s, freq = " << std::setprecision(2) << freq << "\n";
+}
+
+/* emulates the way supervisor "breathes": a burst of messages is enqueued, then
+ * all of them are dequeued one by one */
+template <typename Queue> static void bench_queue(const char *name, std::uint64_t count, std::uint32_t burst) {
+    auto message = r::message_ptr_t(new message::data_t(r::address_ptr_t(), payload::data_t{0}));
+    Queue queue;
+    auto start = bench_clock_t::now();
+    std::uint64_t left = count;
+    while (left) {
+        auto n = std::min<std::uint64_t>(left, burst);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            queue.push_back(message);
+        }
+        while (!queue.empty()) {
+            queue.pop_front();
+        }
+        left -= n;
+    }
+    report(name, count, start);
+}
+
+struct pinger_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::uint64_t count = 0;
+    std::uint32_t burst = 1;
+    bool redirect_mode = false;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::address_maker_plugin_t>([&](auto &p) {
+            pong_addr = p.create_address();
+            ping_addr = p.create_address();
+        });
+        plugin.with_casted<r::plugin::starter_plugin_t>([&](auto &p) {
+            p.subscribe_actor(&pinger_t::on_pong, pong_addr);
+            p.subscribe_actor(&pinger_t::on_ping, ping_addr);
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        left = count;
+        in_flight = std::min<std::uint64_t>(burst, count);
+        start = bench_clock_t::now();
+        for (std::uint32_t i = 0; i < in_flight; ++i) {
+            send<payload::data_t>(pong_addr, payload::data_t{0});
+        }
+    }
+
+    void on_pong(message::data_t &message) noexcept {
+        if (redirect_mode) {
+            redirect(&message, ping_addr);
+        } else {
+            send<payload::data_t>(ping_addr, payload::data_t{0});
+        }
+    }
+
+    void on_ping(message::data_t &message) noexcept {
+        --left;
+        if (left >= in_flight) {
+            if (redirect_mode) {
+                redirect(&message, pong_addr);
+            } else {
+                send<payload::data_t>(pong_addr, payload::data_t{0});
+            }
+        } else if (!left) {
+            report(redirect_mode ? "ping-pong (no-alloc)" : "ping-pong", count * 2, start);
+            do_shutdown();
+        }
+    }
+
+  private:
+    std::uint64_t left = 0;
+    std::uint64_t in_flight = 0;
+    bench_clock_t::time_point start;
+    r::address_ptr_t pong_addr;
+    r::address_ptr_t ping_addr;
+};
+
+static void bench_ping_pong(std::uint64_t count, std::uint32_t burst, bool redirect_mode) {
+    rth::system_context_thread_t ctx;
+    auto timeout = boost::posix_time::milliseconds{100};
+    auto sup = ctx.create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto actor = sup->create_actor<pinger_t>().autoshutdown_supervisor().timeout(timeout).finish();
+    actor->count = count;
+    actor->burst = burst;
+    actor->redirect_mode = redirect_mode;
+    ctx.run();
+}
+
+int main(int argc, char **argv) {
+    try {
+        using boost::conversion::try_lexical_convert;
+        std::uint64_t count = 1000000;
+        std::uint32_t burst = 64;
+        if (argc > 1) {
+            try_lexical_convert(argv[1], count);
+            if (argc > 2) {
+                try_lexical_convert(argv[2], burst);
+            }
+        }
+        burst = std::max<std::uint32_t>(burst, 1);
+        std::cout << "count = " << count << ", burst = " << burst << "\n";
+
+        bench_queue<std::deque<r::message_ptr_t>>("std::deque", count, burst);
+        bench_queue<r::messages_queue_t>("messages_queue_t", count, burst);
+        bench_ping_pong(count, burst, false);
+        bench_ping_pong(count, burst, true);
+    } catch (const std::exception &ex) {
+        std::cout << "exception : " << ex.what();
+    }
+
+    return 0;
+}
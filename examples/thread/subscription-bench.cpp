@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * This is a benchmark of the subscriptions lookup. The actor subscribes
+ * to the specified amount of addresses, and then the single message is
+ * redirected from one address to the next one (in the shuffled order),
+ * i.e. there are no allocations, and the time of the each delivery mostly
+ * consists of the recipients lookup.
+ *
+ * Usage: subscription-bench [count] [subscriptions...]
+ */
+
+#include "rotor.hpp"
+#include "rotor/thread.hpp"
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace r = rotor;
+namespace rth = rotor::thread;
+
+using bench_clock_t = std::chrono::high_resolution_clock;
+
+namespace payload {
+struct data_t {};
+} // namespace payload
+
+namespace message {
+using data_t = r::message_t<payload::data_t>;
+} // namespace message
+
+struct hopper_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::uint64_t count = 0;
+    std::size_t subscriptions = 1;
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        for (std::size_t i = 0; i < subscriptions; ++i) {
+            auto addr = create_address();
+            subscribe(&hopper_t::on_data, addr);
+            addresses.emplace_back(std::move(addr));
+        }
+        std::shuffle(addresses.begin(), addresses.end(), std::mt19937(0));
+        left = count;
+        start = bench_clock_t::now();
+        send<payload::data_t>(addresses.front());
+    }
+
+    void on_data(message::data_t &message) noexcept {
+        if (--left) {
+            if (++index == addresses.size()) {
+                index = 0;
+            }
+            redirect(&message, addresses[index]);
+        } else {
+            std::chrono::duration<double> diff = bench_clock_t::now() - start;
+            double freq = ((double)count) / diff.count();
+            double ns = diff.count() * 1e9 / count;
+            std::cout << "subscriptions = " << std::setw(7) << std::left << subscriptions << ": " << count
+                      << " deliveries in " << std::fixed << std::setprecision(6) << diff.count()
+                      << "s, freq = " << std::setprecision(2) << freq << ", " << ns << "ns per delivery\n";
+            addresses.clear();
+            do_shutdown();
+        }
+    }
+
+  private:
+    std::vector<r::address_ptr_t> addresses;
+    std::uint64_t left = 0;
+    std::size_t index = 0;
+    bench_clock_t::time_point start;
+};
+
+static void bench(std::uint64_t count, std::size_t subscriptions) {
+    rth::system_context_thread_t ctx;
+    auto timeout = boost::posix_time::milliseconds{500};
+    auto sup = ctx.create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto actor = sup->create_actor<hopper_t>().autoshutdown_supervisor().timeout(timeout).finish();
+    actor->count = count;
+    actor->subscriptions = subscriptions;
+    ctx.run();
+}
+
+int main(int argc, char **argv) {
+    try {
+        using boost::conversion::try_lexical_convert;
+        std::uint64_t count = 10000000;
+        std::vector<std::size_t> subscriptions;
+        if (argc > 1) {
+            try_lexical_convert(argv[1], count);
+            for (int i = 2; i < argc; ++i) {
+                std::size_t value = 0;
+                if (try_lexical_convert(argv[i], value) && value) {
+                    subscriptions.push_back(value);
+                }
+            }
+        }
+        if (subscriptions.empty()) {
+            subscriptions = {1, 10, 1000, 100000};
+        }
+        std::cout << "count = " << count << "\n";
+        for (auto value : subscriptions) {
+            bench(count, value);
+        }
+    } catch (const std::exception &ex) {
+        std::cout << "exception : " << ex.what();
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * The offline decoder of the binary traces, recorded by `binary_trace_sink_t`.
+ *
+ * Usage: trace_decode [trace-file]
+ *
+ * If the trace file is not specified, the ping-pong is recorded into
+ * temporary file, which is decoded and removed.
+ */
+
+#include "rotor.hpp"
+#include "rotor/misc/binary_trace_sink.h"
+#include "dummy_supervisor.h"
+#include <boost/core/demangle.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace rm = rotor::misc;
+
+struct ping_t {};
+struct pong_t {};
+
+struct pinger_t : public rotor::actor_base_t {
+    using rotor::actor_base_t::actor_base_t;
+
+    void set_ponger_addr(const rotor::address_ptr_t &addr) { ponger_addr = addr; }
+
+    void configure(rotor::plugin::plugin_base_t &plugin) noexcept override {
+        rotor::actor_base_t::configure(plugin);
+        plugin.with_casted<rotor::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&pinger_t::on_pong); });
+    }
+
+    void on_start() noexcept override {
+        rotor::actor_base_t::on_start();
+        send<ping_t>(ponger_addr);
+    }
+
+    void on_pong(rotor::message_t<pong_t> &) noexcept { do_shutdown(); }
+
+    rotor::address_ptr_t ponger_addr;
+};
+
+struct ponger_t : public rotor::actor_base_t {
+    using rotor::actor_base_t::actor_base_t;
+
+    void configure(rotor::plugin::plugin_base_t &plugin) noexcept override {
+        rotor::actor_base_t::configure(plugin);
+        plugin.with_casted<rotor::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&ponger_t::on_ping); });
+    }
+
+    void on_ping(rotor::message_t<ping_t> &) noexcept { send<pong_t>(pinger_addr); }
+
+    rotor::address_ptr_t pinger_addr;
+};
+
+static void record(const std::string &path) {
+    rm::binary_trace_sink_t sink(path, 1024);
+    rotor::system_context_t ctx{};
+    auto timeout = boost::posix_time::milliseconds{500}; /* does not matter */
+    auto sup = ctx.create_supervisor<dummy_supervisor_t>().timeout(timeout).finish();
+    sup->trace(&sink);
+
+    auto pinger = sup->create_actor<pinger_t>().timeout(timeout).autoshutdown_supervisor().finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(timeout).finish();
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->pinger_addr = pinger->get_address();
+
+    sup->do_process();
+    sup->trace(nullptr);
+}
+
+static const char *event_name(std::uint32_t event) {
+    switch (static_cast<rotor::trace_event_t>(event)) {
+    case rotor::trace_event_t::delivered:
+        return ">>";
+    case rotor::trace_event_t::discarded:
+        return "<DISCARDED>";
+    case rotor::trace_event_t::forwarded:
+        return "->";
+    }
+    return "??";
+}
+
+static bool decode(const std::string &path) {
+    std::ifstream in(path, std::ios_base::binary);
+    rm::trace_file_header_t header;
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != rm::trace_file_header_t::magic_value || header.record_size != sizeof(rm::trace_record_t)) {
+        std::cout << path << " is not a rotor trace file\n";
+        return false;
+    }
+
+    std::vector<rm::trace_type_name_t> type_names(header.max_types);
+    std::vector<char> names(header.names_capacity);
+    std::vector<rm::trace_record_t> records(header.capacity);
+    in.read(reinterpret_cast<char *>(type_names.data()),
+            static_cast<std::streamsize>(type_names.size() * sizeof(rm::trace_type_name_t)));
+    in.read(names.data(), static_cast<std::streamsize>(names.size()));
+    in.read(reinterpret_cast<char *>(records.data()),
+            static_cast<std::streamsize>(records.size() * sizeof(rm::trace_record_t)));
+    if (!in) {
+        std::cout << path << " is truncated\n";
+        return false;
+    }
+
+    auto count = std::min(header.written, header.capacity);
+    auto first = header.written - count;
+    auto start = count ? records[first % header.capacity].timestamp : 0;
+    std::cout << path << ": " << header.written << " messages recorded, " << count << " are available\n";
+    for (auto i = first; i < header.written; ++i) {
+        auto &r = records[i % header.capacity];
+        std::string type = "?";
+        if (r.type_id < header.max_types) {
+            auto &entry = type_names[r.type_id];
+            if (entry.offset == rm::trace_type_name_t::lost_offset) {
+                type = "<lost type name of " + std::to_string(entry.length) + " bytes>";
+            } else if (entry.length && std::uint64_t{entry.offset} + entry.length <= names.size()) {
+                type = boost::core::demangle(std::string(names.data() + entry.offset, entry.length).c_str());
+            }
+        }
+        std::cout << "+" << (r.timestamp - start) << "ns [" << std::hex << r.supervisor << "] " << event_name(r.event)
+                  << " " << type << " => " << r.address << std::dec << " (" << r.queue_depth << " queued)\n";
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    try {
+        if (argc > 1) {
+            return decode(argv[1]) ? 0 : 1;
+        }
+        auto path = (std::filesystem::temp_directory_path() / "rotor-trace_decode.bin").string();
+        record(path);
+        auto ok = decode(path);
+        std::remove(path.c_str());
+        return ok ? 0 : 1;
+    } catch (const std::exception &ex) {
+        std::cout << "exception : " << ex.what() << "\n";
+        return 1;
+    }
+}
@@ -14,6 +14,7 @@
 #include "handler.h"
 #include "extended_error.h"
 #include "timer_handler.hpp"
+#include "request_slots.h"
 #include <set>
 
 #if defined(_MSC_VER)
@@ -352,6 +353,8 @@ struct ROTOR_API actor_base_t : public arc_base_t<actor_base_t> {
      * with `true` to mark that it was cancelled.
      *
      * Upon cancellation the timer callback will be invoked immediately, in the context of caller.
+     *
+     * The request id can be used too: then the request is discarded without response.
      */
     void cancel_timer(request_id_t request_id) noexcept;
 
@@ -411,8 +414,8 @@ struct ROTOR_API actor_base_t : public arc_base_t<actor_base_t> {
     /** \brief timer-id to timer-handler map (type) */
     using timers_map_t = std::unordered_map<request_id_t, timer_handler_ptr_t>;
 
-    /** \brief list of ids of active requests (type) */
-    using requests_t = std::unordered_set<request_id_t>;
+    /** \brief list of active requests (type) */
+    using requests_t = request_list_t;
 
     /** \brief triggers timer handler associated with the timer id */
     void on_timer_trigger(request_id_t request_id, bool cancelled) noexcept;
@@ -496,7 +499,7 @@ struct ROTOR_API actor_base_t : public arc_base_t<actor_base_t> {
     /** \brief timer-id to timer-handler map */
     timers_map_t timers_map;
 
-    /** \brief list of ids of active requests */
+    /** \brief list of active requests */
     requests_t active_requests;
 
     /** \brief set of currently processing states, i.e. init or shutdown
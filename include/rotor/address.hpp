@@ -8,6 +8,7 @@
 
 #include "arc.hpp"
 #include "forward.hpp"
+#include <cstdint>
 
 namespace rotor {
 
@@ -28,6 +29,14 @@ namespace rotor {
  * Addresses are non-copyable and non-moveable. The constructor is private
  * and it is intended to be created by supervisor only.
  *
+ * An address might be *pinned*, i.e. owned by the {@link system_context_t}
+ * rather than by its intrusive pointers. The reference counter of a pinned
+ * address is never touched, so passing it around (e.g. as a message destination
+ * or as `reply_to` of a request) costs no atomic operations. Pinned addresses are
+ * released all at once when the system context is destroyed, and they are never
+ * re-used for other actors; nevertheless, they should not be kept after their
+ * owner (supervisor) has been removed.
+ *
  */
 
 struct address_t : public arc_base_t<address_t> {
@@ -37,6 +46,23 @@ struct address_t : public arc_base_t<address_t> {
     /** \brief runtime label, describing some execution group */
     const void *locality;
 
+    /** \brief precomputed hash of the address, i.e. of its memory location */
+    const std::size_t hash;
+
+    /** \brief message type of the cached single recipient (`nullptr` if there is no cache)
+     *
+     * When the message type has the single local handler on the address, the
+     * handler is cached here and the message is delivered without subscriptions
+     * lookup. The cache is maintained by the subscription_t of the address locality.
+     */
+    const void *cached_type = nullptr;
+
+    /** \brief the single local handler of the `cached_type` messages on the address */
+    handler_base_t *cached_handler = nullptr;
+
+    /** \brief whether the address is owned by the system context, see `supervisor_config_t::pin_addresses` */
+    const bool pinned;
+
     address_t(const address_t &) = delete;
     address_t(address_t &&) = delete;
 
@@ -50,7 +76,31 @@ struct address_t : public arc_base_t<address_t> {
 
   private:
     friend struct supervisor_t;
-    address_t(supervisor_t &sup, const void *locality_) : supervisor{sup}, locality{locality_} {}
+    address_t(supervisor_t &sup, const void *locality_, bool pinned_ = false)
+        : supervisor{sup}, locality{locality_}, hash{mix(this)}, pinned{pinned_} {}
+
+    using counter_base_t = arc_base_t<address_t>;
+
+    /** \brief increments the reference counter unless the address is pinned */
+    friend inline void intrusive_ptr_add_ref(const address_t *address) noexcept {
+        if (!address->pinned) {
+            intrusive_ptr_add_ref(static_cast<const counter_base_t *>(address));
+        }
+    }
+
+    /** \brief decrements the reference counter unless the address is pinned */
+    friend inline void intrusive_ptr_release(const address_t *address) noexcept {
+        if (!address->pinned) {
+            intrusive_ptr_release(static_cast<const counter_base_t *>(address));
+        }
+    }
+
+    static inline std::size_t mix(const void *ptr) noexcept {
+        auto value = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return static_cast<std::size_t>(value ^ (value >> 31));
+    }
 };
 
 /** \brief intrusive pointer for address */
@@ -65,7 +115,7 @@ namespace std {
 template <> struct hash<rotor::address_ptr_t> {
     /** \brief Calculates hash for the address */
     inline size_t operator()(const rotor::address_ptr_t &address) const noexcept {
-        return reinterpret_cast<size_t>(address.get());
+        return address ? address->hash : 0;
     }
 };
 
@@ -68,7 +68,7 @@ template <typename Class> struct callback_traits<void (Class::*)() noexcept> {
 
 } // namespace details
 
-/** \brief return `strand` of the boost::asio aware actor */
+/** \brief return `strand` of the boost::asio aware actor (only for the supervisor configured with strand) */
 template <typename Actor> inline boost::asio::io_context::strand &get_strand(Actor &actor);
 
 /** \brief templated forwarder base class */
@@ -129,15 +129,14 @@ struct forwarder_t<Actor, Handler, details::count::_0, ErrHandler> : forwarder_b
      */
     template <typename T = void> inline void operator()(const boost::system::error_code &ec) noexcept {
         auto &typed_actor = base_t::typed_actor;
-        auto &sup = static_cast<supervisor_asio_t &>(typed_actor->get_supervisor());
-        auto &strand = get_strand(sup);
+        auto &sup = static_cast<typename base_t::typed_sup_t &>(typed_actor->get_supervisor());
         if (ec) {
-            asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::err_handler), ec]() {
+            sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::err_handler), ec]() {
                 ((*actor).*handler)(ec);
                 actor->get_supervisor().do_process();
             });
         } else {
-            asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::handler)]() {
+            sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::handler)]() {
                 ((*actor).*handler)();
                 actor->get_supervisor().do_process();
             });
@@ -157,16 +156,15 @@ struct forwarder_t<Actor, Handler, details::count::_1, ErrHandler> : forwarder_b
      */
     template <typename T> inline void operator()(const boost::system::error_code &ec, T arg) noexcept {
         auto &typed_actor = base_t::typed_actor;
-        auto &sup = static_cast<supervisor_asio_t &>(typed_actor->get_supervisor());
-        auto &strand = get_strand(sup);
+        auto &sup = static_cast<typename base_t::typed_sup_t &>(typed_actor->get_supervisor());
         if (ec) {
-            asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::err_handler), ec = ec]() {
+            sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::err_handler), ec = ec]() {
                 ((*actor).*handler)(ec);
                 actor->get_supervisor().do_process();
             });
         } else {
-            asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::handler),
-                                 arg = std::move(arg)]() mutable {
+            sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::handler),
+                               arg = std::move(arg)]() mutable {
                 ((*actor).*handler)(std::move(arg));
                 actor->get_supervisor().do_process();
             });
@@ -186,9 +184,8 @@ struct forwarder_t<Actor, Handler, details::count::_0, void> : forwarder_base_t<
      */
     template <typename T = void> inline void operator()() noexcept {
         auto &typed_actor = base_t::typed_actor;
-        auto &sup = static_cast<supervisor_asio_t &>(typed_actor->get_supervisor());
-        auto &strand = get_strand(sup);
-        asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::handler)]() {
+        auto &sup = static_cast<typename base_t::typed_sup_t &>(typed_actor->get_supervisor());
+        sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::handler)]() {
             ((*actor).*handler)();
             actor->get_supervisor().do_process();
         });
@@ -207,10 +204,9 @@ struct forwarder_t<Actor, Handler, details::count::_1, void> : forwarder_base_t<
      */
     template <typename T> inline void operator()(T arg) noexcept {
         auto &typed_actor = base_t::typed_actor;
-        auto &sup = static_cast<supervisor_asio_t &>(typed_actor->get_supervisor());
-        auto &strand = get_strand(sup);
-        asio::defer(strand, [actor = base_t::typed_actor, handler = std::move(base_t::handler),
-                             arg = std::move(arg)]() mutable {
+        auto &sup = static_cast<typename base_t::typed_sup_t &>(typed_actor->get_supervisor());
+        sup.defer_handler([actor = base_t::typed_actor, handler = std::move(base_t::handler),
+                           arg = std::move(arg)]() mutable {
             ((*actor).*handler)(std::move(arg));
             actor->get_supervisor().do_process();
         });
@@ -7,12 +7,15 @@
 //
 
 #include "rotor/supervisor.h"
+#include "rotor/timer_wheel.h"
 #include "rotor/asio/export.h"
 #include "supervisor_config_asio.h"
 #include "system_context_asio.h"
 #include "forwarder.hpp"
 #include <boost/asio.hpp>
-#include <unordered_map>
+#include <boost/version.hpp>
+#include <atomic>
+#include <cassert>
 #include <memory>
 
 #if defined(_MSC_VER)
@@ -52,6 +55,12 @@ template <typename Actor, typename Handler, typename ArgsCount, typename ErrHand
  * handler, the change should be performed in synchronized way, i.e.
  * via `strand`.
  *
+ * Instead of the legacy `boost::asio::io_context::strand` the supervisor
+ * can be configured with the executor, i.e. with `boost::asio::strand<...>`
+ * or, when the `io_context` is run by a single thread, with the plain
+ * `io_context` executor. In the last case the handlers are executed without
+ * any strand synchronization.
+ *
  */
 struct ROTOR_ASIO_API supervisor_asio_t : public supervisor_t {
 
@@ -69,6 +78,7 @@ struct ROTOR_ASIO_API supervisor_asio_t : public supervisor_t {
     virtual void start() noexcept override;
     virtual void shutdown() noexcept override;
     virtual void enqueue(message_ptr_t message) noexcept override;
+    virtual void enqueue_batch(messages_queue_t &messages) noexcept override;
     virtual void shutdown_finish() noexcept override;
 
     /** \brief an helper for creation {@link forwarder_t} */
@@ -82,53 +92,108 @@ struct ROTOR_ASIO_API supervisor_asio_t : public supervisor_t {
         return forwarder_t{*this, std::move(handler)};
     }
 
-    /** \brief returns execution strand */
-    inline asio::io_context::strand &get_strand() noexcept { return *strand; }
-
-    /** \brief process queue of messages of locality leader */
-    void do_process() noexcept;
-
-  protected:
-    /** \struct timer_t
-     * \brief boos::asio::steady_timer with embedded timer handler */
-    struct timer_t : public asio::steady_timer {
+    /** \brief alias for boost::asio polymorphic executor */
+    using executor_t = supervisor_config_asio_t::executor_t;
+
+    /** \brief returns execution strand (only if the supervisor is configured with strand)
+     *
+     * It must not be invoked, when the supervisor is configured with executor. Actors,
+     * which are agnostic to the supervisor flavour, should use `get_io_executor()`
+     * for I/O objects (timers, sockets etc.) and `defer_handler()` (or `forwarder_t`)
+     * for the execution in the supervisor context.
+     */
+    inline asio::io_context::strand &get_strand() noexcept {
+        assert(strand && "the supervisor is configured with executor, use get_io_executor() or defer_handler()");
+        return *strand;
+    }
 
-        /** \brief non-owning pointer to timer handler */
-        timer_handler_base_t *handler;
+    /** \brief returns executor (only if the supervisor is configured with executor) */
+    inline const executor_t &get_executor() noexcept {
+        assert(executor && "the supervisor is configured with strand, use get_io_executor() or defer_handler()");
+        return *executor;
+    }
 
-        /** \brief constructs timer using timer handler and boost asio io_context */
-        timer_t(timer_handler_base_t *handler_, asio::io_context &io_context)
-            : asio::steady_timer(io_context), handler{handler_} {}
-    };
+    /** \brief returns the underlying io_context executor, suitable for creation of timers, sockets etc.
+     *
+     * It is available for both strand and executor supervisor flavours.
+     */
+    executor_t get_io_executor() noexcept;
+
+    /** \brief defers the handler execution onto the supervisor strand (or executor)
+     *
+     * The handler memory is allocated via the associated allocator, which
+     * recycles the memory blocks of the previously executed handlers.
+     */
+    template <typename Handler> void defer_handler(Handler &&handler) noexcept {
+#if BOOST_VERSION >= 107900
+        auto bound = asio::bind_allocator(asio::recycling_allocator<void>(), std::forward<Handler>(handler));
+#else
+        auto &bound = handler;
+#endif
+        if (strand) {
+            asio::defer(*strand, std::move(bound));
+        } else {
+            asio::defer(*executor, std::move(bound));
+        }
+    }
 
-    /** \brief unique pointer to timer */
-    using timer_ptr_t = std::unique_ptr<timer_t>;
+    /** \brief process queue of messages of locality leader
+     *
+     * The inbound messages are taken until the inbound queue becomes empty,
+     * which lets the producers skip waking up the strand meanwhile.
+     */
+    void do_process() noexcept;
 
-    /** \brief timer id to timer pointer mapping type */
-    using timers_map_t = std::unordered_map<request_id_t, timer_ptr_t>;
+  protected:
+    /** \brief alias for monotonic clock of the timers */
+    using clock_t = timer_wheel_t::clock_t;
 
     void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    void do_cancel_timer(request_id_t timer_id) noexcept override;
+    void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
 
     /** \brief guard type : alias for asio executor_work_guard */
-    using guard_t = asio::executor_work_guard<asio::io_context::executor_type>;
+    using guard_t = asio::executor_work_guard<executor_t>;
 
     /** \brief alias for a guard */
     using guard_ptr_t = std::unique_ptr<guard_t>;
 
-    /** \brief timer id to timer pointer mapping */
-    timers_map_t timers_map;
-
-    /** \brief config for the supervisor */
+    /** \brief execution strand (legacy), if any */
     supervisor_config_asio_t::strand_ptr_t strand;
 
+    /** \brief executor, if the supervisor is not configured with strand */
+    supervisor_config_asio_t::executor_ptr_t executor;
+
     /** \brief guard to control ownership of the io-context */
     guard_ptr_t guard;
 
+    /** \brief pending rotor timers of the supervisor
+     *
+     * Timers start and cancellation is just bookkeeping of the wheel, and
+     * the single asio timer is (re)armed to the nearest deadline.
+     */
+    timer_wheel_t timers;
+
+    /** \brief asio timer, which is armed to the nearest deadline of the pending timers */
+    asio::steady_timer timer;
+
+    /** \brief the time point, the asio timer is armed to, or `time_point::max()` if it is not armed */
+    clock_t::time_point armed_deadline;
+
+    /** \brief whether processing of the inbound queue is already scheduled (used only by locality leader)
+     *
+     * Only the first message, enqueued since the last inbound queue drain, posts
+     * the processing handler into the strand (or executor).
+     */
+    std::atomic_bool wakeup_pending{false};
+
   private:
     void invoke_shutdown() noexcept;
+    void wakeup() noexcept;
+    void arm_timer() noexcept;
+    void on_timer(const sys::error_code &ec) noexcept;
 };
 
+/** \brief returns `strand` of the boost::asio aware actor (only for the supervisor configured with strand) */
 template <typename Actor> inline boost::asio::io_context::strand &get_strand(Actor &actor) {
     return actor.get_strand();
 }
@@ -19,7 +19,16 @@ namespace rotor {
 namespace asio {
 
 /** \struct supervisor_config_asio_t
- *  \brief boost::asio supervisor config, which holds pointer to strand */
+ *  \brief boost::asio supervisor config, which holds pointer to strand or to executor
+ *
+ * Either the (legacy) `strand` or the `executor` should be set. The executor
+ * might be the strand, i.e. `boost::asio::make_strand(io_context)`, or, when
+ * the `io_context` is run by a single thread, just `io_context.get_executor()`,
+ * which avoids the strand synchronization overhead.
+ *
+ * The supervisors sharing the same strand (or executor) pointer are the same
+ * locality.
+ */
 struct supervisor_config_asio_t : public supervisor_config_t {
     /** \brief alias for boost::asio strand type */
     using strand_t = boost::asio::io_context::strand;
@@ -27,9 +36,18 @@ struct supervisor_config_asio_t : public supervisor_config_t {
     /** \brief type for strand shared pointer */
     using strand_ptr_t = std::shared_ptr<strand_t>;
 
+    /** \brief alias for boost::asio polymorphic executor type */
+    using executor_t = boost::asio::any_io_executor;
+
+    /** \brief type for executor shared pointer */
+    using executor_ptr_t = std::shared_ptr<executor_t>;
+
     /** \brief boost::asio execution strand (shared pointer) */
     strand_ptr_t strand;
 
+    /** \brief boost::asio executor (shared pointer) */
+    executor_ptr_t executor;
+
     /** \brief should supervisor take ownership on the io_context */
     bool guard_context = false;
 
@@ -48,7 +66,10 @@ template <typename Supervisor> struct supervisor_config_asio_builder_t : supervi
     /** \brief alias for strand smart pointer */
     using strand_ptr_t = supervisor_config_asio_t::strand_ptr_t;
 
-    /** \brief bit mask for strand validation */
+    /** \brief alias for executor smart pointer */
+    using executor_ptr_t = supervisor_config_asio_t::executor_ptr_t;
+
+    /** \brief bit mask for strand (or executor) validation */
     constexpr static const std::uint32_t STRAND = 1 << 2;
 
     /** \brief bit mask for all required fields */
@@ -61,6 +82,13 @@ template <typename Supervisor> struct supervisor_config_asio_builder_t : supervi
         return std::move(*static_cast<builder_t *>(this));
     }
 
+    /** \brief executor setter, an alternative to the strand */
+    builder_t &&executor(executor_ptr_t &executor) && {
+        parent_t::config.executor = executor;
+        parent_t::mask = (parent_t::mask & ~STRAND);
+        return std::move(*static_cast<builder_t *>(this));
+    }
+
     /** \brief instructs to take ownership of the io_context */
     builder_t &&guard_context(bool value) && {
         parent_t::config.guard_context = value;
@@ -0,0 +1,171 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/** \file coro.hpp
+ * Optional C++20 coroutines support: awaitable requests
+ *
+ * The header does not require rotor itself to be compiled with C++20, only
+ * the translation units, which include it.
+ */
+
+#if !defined(__cpp_impl_coroutine)
+#error "rotor/coro.hpp requires C++20 coroutines support"
+#endif
+
+#include "rotor/supervisor.h"
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+
+namespace rotor {
+
+/// namespace for C++20 coroutines support
+namespace coro {
+
+namespace details {
+
+/** \brief the prefix of the coroutine frame memory block */
+struct alignas(message_pool_t::alignment) frame_header_t {
+    /** \brief the pool, the frame has been allocated from, or `nullptr` for heap */
+    message_pool_t *pool;
+};
+
+/** \brief allocates coroutine frame from the pool, if there is one and the frame fits into it */
+inline void *allocate_frame(message_pool_t *pool, std::size_t size) {
+    auto total = sizeof(frame_header_t) + size;
+    void *memory = pool ? pool->allocate(total) : nullptr;
+    if (!memory) {
+        pool = nullptr;
+        memory = ::operator new(total);
+    }
+    auto header = new (memory) frame_header_t{pool};
+    return header + 1;
+}
+
+/** \brief returns the coroutine frame memory to the pool (or to the heap) */
+inline void deallocate_frame(void *frame) noexcept {
+    auto header = static_cast<frame_header_t *>(frame) - 1;
+    auto pool = header->pool;
+    if (pool) {
+        pool->deallocate(header);
+    } else {
+        ::operator delete(header);
+    }
+}
+
+} // namespace details
+
+/** \struct task_t
+ *  \brief fire-and-forget coroutine of an actor
+ *
+ * The coroutine starts eagerly, i.e. it is executed until the first suspension
+ * point upon invocation, and its frame is destroyed upon completion.
+ *
+ * When the coroutine is started during messages processing (i.e. from a message
+ * handler), its frame is allocated from the messages pool of the locality (if the
+ * pool is enabled via `pool_messages()` supervisor config option), otherwise the
+ * frame is allocated on heap.
+ *
+ * The coroutine should be suspended only on rotor awaitables (see `send`), i.e.
+ * it is always resumed on the supervisor thread. Exceptions must not escape
+ * the coroutine.
+ */
+struct task_t {
+    /** \struct promise_type
+     *  \brief the coroutine promise */
+    struct promise_type {
+        /** \brief allocates the frame from the pool of the locality, executed by the current thread (if any) */
+        static void *operator new(std::size_t size) {
+            return details::allocate_frame(message_pool_t::current(), size);
+        }
+
+        /** \brief deallocates the frame */
+        static void operator delete(void *frame) noexcept { details::deallocate_frame(frame); }
+
+        /** \brief returns the (empty) task */
+        task_t get_return_object() noexcept { return {}; }
+
+        /** \brief the coroutine is started immediately */
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        /** \brief the coroutine frame is destroyed upon completion */
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        /** \brief no result */
+        void return_void() noexcept {}
+
+        /** \brief exceptions are not allowed */
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/** \struct request_awaiter_t
+ *  \brief sends the request upon the coroutine suspension and resumes the coroutine
+ *  with the response
+ *
+ * The coroutine is resumed directly by the supervisor, which processes the response
+ * (or generates timeout error), i.e. without extra message delivery.
+ *
+ * If the request is cancelled without response (i.e. the requesting actor shuts down),
+ * the suspended coroutine is destroyed without resumption.
+ */
+template <typename T> struct [[nodiscard]] request_awaiter_t : request_continuation_t {
+    /** \brief alias for the request traits */
+    using traits_t = request_traits_t<T>;
+
+    /** \brief response message type */
+    using response_message_t = typename traits_t::response::message_t;
+
+    /** \brief intrusive pointer to the response message, the `co_await` result */
+    using response_ptr_t = typename traits_t::response::message_ptr_t;
+
+    /** \brief captures the not yet sent request and its timeout */
+    request_awaiter_t(request_builder_t<T> &&builder_, const pt::time_duration &timeout_) noexcept
+        : builder{std::move(builder_)}, timeout{timeout_} {}
+
+    /** \brief the response is never ready before the request is sent */
+    bool await_ready() const noexcept { return false; }
+
+    /** \brief sends the request */
+    void await_suspend(std::coroutine_handle<> handle_) noexcept {
+        handle = handle_;
+        builder.send(timeout, *this);
+    }
+
+    /** \brief returns the response message (it might contain error, i.e. timeout) */
+    response_ptr_t await_resume() noexcept { return std::move(response); }
+
+    void resume(message_ptr_t message) noexcept override {
+        response.reset(static_cast<response_message_t *>(message.get()));
+        handle.resume();
+    }
+
+    void abandon() noexcept override { handle.destroy(); }
+
+  private:
+    request_builder_t<T> builder;
+    pt::time_duration timeout;
+    std::coroutine_handle<> handle;
+    response_ptr_t response;
+};
+
+/** \brief makes the request awaitable within actor coroutine, i.e.
+ *
+ * ```
+ * auto reply = co_await coro::send(request<payload_t>(addr, args...), timeout);
+ * if (!reply->payload.ee) { ... }
+ * ```
+ */
+template <typename T>
+request_awaiter_t<T> send(request_builder_t<T> &&builder, const pt::time_duration &timeout) noexcept {
+    return {std::move(builder), timeout};
+}
+
+} // namespace coro
+} // namespace rotor
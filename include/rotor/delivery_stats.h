@@ -0,0 +1,178 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(ROTOR_DELIVERY_STATS)
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace rotor {
+
+/** \struct delivery_counters_t
+ *  \brief snapshot of the messages delivery statistics of a supervisor
+ *
+ * All the values are accumulated since the supervisor creation. The batch
+ * histogram bucket `i` counts `process()` invocations, which delivered
+ * `[2^i, 2^(i+1))` messages (the last bucket counts all the larger batches).
+ */
+struct delivery_counters_t {
+    /** \brief amount of the batch size histogram buckets */
+    static constexpr std::size_t batch_buckets = 16;
+
+    /** \brief messages delivered to local recipients */
+    std::uint64_t dispatched = 0;
+
+    /** \brief messages forwarded to the supervisors of other localities */
+    std::uint64_t forwarded = 0;
+
+    /** \brief messages without recipients */
+    std::uint64_t discarded = 0;
+
+    /** \brief messages taken from the inbound queue */
+    std::uint64_t inbound_pops = 0;
+
+    /** \brief time spent in message handlers, nanoseconds */
+    std::uint64_t handlers_time = 0;
+
+    /** \brief the maximum observed depth of the messages queue */
+    std::uint64_t max_queue_depth = 0;
+
+    /** \brief histogram of the processed batch sizes */
+    std::uint64_t batches[batch_buckets] = {};
+};
+
+/** \struct delivery_stats_t
+ *  \brief lock-free messages delivery counters of a supervisor
+ *
+ * The counters are updated by the supervisor thread only (i.e. the updates
+ * are plain relaxed stores without read-modify-write), and they can be read
+ * from any thread via `snapshot()`.
+ *
+ * Unless rotor is built with `ROTOR_DELIVERY_STATS` option, the counters and
+ * the update methods compile to nothing, and the snapshot is always zero.
+ */
+struct delivery_stats_t {
+#if defined(ROTOR_DELIVERY_STATS)
+    /** \struct handlers_timer_t
+     *  \brief measures the time of handlers invocation until the destruction */
+    struct handlers_timer_t {
+        /** \brief the clock type */
+        using clock_t = std::chrono::steady_clock;
+
+        /** \brief remembers the current time point */
+        handlers_timer_t(delivery_stats_t &stats_) noexcept : stats{stats_}, started{clock_t::now()} {}
+
+        ~handlers_timer_t() {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - started).count();
+            stats.add(stats.handlers_time, static_cast<std::uint64_t>(ns));
+        }
+
+        /** \brief the owner statistics */
+        delivery_stats_t &stats;
+
+        /** \brief the time point of the timer start */
+        clock_t::time_point started;
+    };
+
+    /** \brief records message delivery to local recipients */
+    inline void on_dispatched() noexcept { add(dispatched, 1); }
+
+    /** \brief records message forwarding to other locality */
+    inline void on_forwarded() noexcept { add(forwarded, 1); }
+
+    /** \brief records message without recipients */
+    inline void on_discarded() noexcept { add(discarded, 1); }
+
+    /** \brief records message taken from the inbound queue */
+    inline void on_inbound_pop() noexcept { add(inbound_pops, 1); }
+
+    /** \brief records the current depth of the messages queue */
+    inline void on_queue_depth(std::size_t depth) noexcept {
+        if (depth > max_queue_depth.load(std::memory_order_relaxed)) {
+            max_queue_depth.store(depth, std::memory_order_relaxed);
+        }
+    }
+
+    /** \brief records the size of the processed messages batch */
+    inline void on_batch(std::size_t size) noexcept {
+        if (size) {
+            std::size_t bucket = 0;
+            while (size >>= 1) {
+                ++bucket;
+            }
+            auto last = delivery_counters_t::batch_buckets - 1;
+            add(batches[bucket < last ? bucket : last], 1);
+        }
+    }
+
+    /** \brief returns timer, which accounts handlers time upon destruction */
+    inline handlers_timer_t measure_handlers() noexcept { return handlers_timer_t(*this); }
+
+    /** \brief returns the current values of the counters (can be invoked from any thread) */
+    delivery_counters_t snapshot() const noexcept {
+        delivery_counters_t r;
+        r.dispatched = dispatched.load(std::memory_order_relaxed);
+        r.forwarded = forwarded.load(std::memory_order_relaxed);
+        r.discarded = discarded.load(std::memory_order_relaxed);
+        r.inbound_pops = inbound_pops.load(std::memory_order_relaxed);
+        r.handlers_time = handlers_time.load(std::memory_order_relaxed);
+        r.max_queue_depth = max_queue_depth.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < delivery_counters_t::batch_buckets; ++i) {
+            r.batches[i] = batches[i].load(std::memory_order_relaxed);
+        }
+        return r;
+    }
+
+  private:
+    using counter_t = std::atomic<std::uint64_t>;
+
+    static inline void add(counter_t &counter, std::uint64_t value) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    counter_t dispatched{0};
+    counter_t forwarded{0};
+    counter_t discarded{0};
+    counter_t inbound_pops{0};
+    counter_t handlers_time{0};
+    counter_t max_queue_depth{0};
+    counter_t batches[delivery_counters_t::batch_buckets] = {};
+#else
+    /** \brief no-op handlers timer */
+    struct handlers_timer_t {};
+
+    /** \brief records message delivery to local recipients (no-op) */
+    inline void on_dispatched() noexcept {}
+
+    /** \brief records message forwarding to other locality (no-op) */
+    inline void on_forwarded() noexcept {}
+
+    /** \brief records message without recipients (no-op) */
+    inline void on_discarded() noexcept {}
+
+    /** \brief records message taken from the inbound queue (no-op) */
+    inline void on_inbound_pop() noexcept {}
+
+    /** \brief records the current depth of the messages queue (no-op) */
+    inline void on_queue_depth(std::size_t) noexcept {}
+
+    /** \brief records the size of the processed messages batch (no-op) */
+    inline void on_batch(std::size_t) noexcept {}
+
+    /** \brief returns no-op timer */
+    inline handlers_timer_t measure_handlers() noexcept { return {}; }
+
+    /** \brief returns zero counters */
+    delivery_counters_t snapshot() const noexcept { return {}; }
+#endif
+};
+
+} // namespace rotor
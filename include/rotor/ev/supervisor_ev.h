@@ -7,13 +7,12 @@
 //
 
 #include "rotor/supervisor.h"
+#include "rotor/timer_wheel.h"
 #include "rotor/ev/export.h"
 #include "rotor/ev/supervisor_config_ev.h"
 #include "rotor/ev/system_context_ev.h"
 #include "rotor/system_context.h"
 #include <ev.h>
-#include <memory>
-#include <unordered_map>
 
 namespace rotor {
 namespace ev {
@@ -31,6 +30,9 @@ namespace ev {
  * in that case different supervisors, and they will be able to communicate
  * via rotor-messaging.
  *
+ * The rotor timers of the supervisor are multiplexed into the single
+ * `ev_timer`, which is armed to the nearest deadline.
+ *
  */
 struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
     /** \brief injects an alias for supervisor_config_ev_t */
@@ -39,24 +41,6 @@ struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
     /** \brief injects templated supervisor_config_ev_builder_t */
     template <typename Supervisor> using config_builder_t = supervisor_config_ev_builder_t<Supervisor>;
 
-    /** \struct timer_t
-     * \brief inheritance of ev_timer, which holds rotor `timer_id`
-     */
-    struct timer_t : public ev_timer {
-
-        /** \brief intrusive pointer to ev supervisor (type) */
-        using supervisor_ptr_t = intrusive_ptr_t<supervisor_ev_t>;
-
-        /** \brief non-owning pointer to timer handler */
-        timer_handler_base_t *handler;
-
-        /** \brief intrusive pointer to the supervisor */
-        supervisor_ptr_t sup;
-    };
-
-    /** \brief an alias for unique pointer, holding `timer_t` */
-    using timer_ptr_t = std::unique_ptr<timer_t>;
-
     /** \brief constructs new supervisor from ev supervisor config */
     supervisor_ev_t(supervisor_config_ev_t &config);
     virtual void do_initialize(system_context_t *ctx) noexcept override;
@@ -65,6 +49,7 @@ struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
     void start() noexcept override;
     void shutdown() noexcept override;
     void enqueue(message_ptr_t message) noexcept override;
+    void enqueue_batch(messages_queue_t &messages) noexcept override;
     void shutdown_finish() noexcept override;
 
     /** \brief retuns ev-loop associated with the supervisor */
@@ -74,14 +59,17 @@ struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
     template <typename T> auto &access() noexcept;
 
   protected:
-    /** \brief a type for mapping `timer_id` to timer pointer */
-    using timers_map_t = std::unordered_map<request_id_t, timer_ptr_t>;
+    /** \brief alias for monotonic clock of the timers */
+    using clock_t = timer_wheel_t::clock_t;
 
     /** \brief EV-specific trampoline function for `on_async` method */
     static void async_cb(EV_P_ ev_async *w, int revents) noexcept;
 
+    /** \brief EV-specific trampoline function for `on_timer` method */
+    static void timer_cb(EV_P_ ev_timer *w, int revents) noexcept;
+
     void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    void do_cancel_timer(request_id_t timer_id) noexcept override;
+    void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
 
     /** \brief Process external messages (from inbound queue).
      *
@@ -92,6 +80,9 @@ struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
      */
     virtual void on_async() noexcept;
 
+    /** \brief triggers expired timers and re-arms the timer watcher */
+    virtual void on_timer() noexcept;
+
     /** \brief a pointer to EV event loop, copied from config */
     struct ev_loop *loop;
 
@@ -104,13 +95,23 @@ struct ROTOR_EV_API supervisor_ev_t : public supervisor_t {
     /** \brief how much time spend in active inbound queue polling */
     ev_tstamp poll_duration;
 
-    /** \brief timer_id to timer map */
-    timers_map_t timers_map;
+    /** \brief pending rotor timers of the supervisor */
+    timer_wheel_t timers;
+
+    /** \brief ev-loop timer watcher, armed to the nearest deadline of the pending timers
+     *
+     * The supervisor holds a reference to itself while the watcher is active.
+     */
+    ev_timer timer_watcher;
+
+    /** \brief the time point, the timer watcher is armed to, or `time_point::max()` if it is not active */
+    clock_t::time_point armed_deadline;
 
     friend struct supervisor_ev_shutdown_t;
 
   private:
     void move_inbound_queue() noexcept;
+    void arm_timer() noexcept;
 };
 
 } // namespace ev
@@ -67,6 +67,19 @@ struct ROTOR_API extended_error_t : arc_base_t<extended_error_t> {
     extended_error_ptr_t root() const noexcept;
 };
 
+/** \brief shares the request messages, referenced from the chain of extended errors
+ *
+ * It should be invoked from `share_nested` of the payloads, which hold
+ * an extended error (see `message_base_t::share()`).
+ */
+inline void share_requests(const extended_error_ptr_t &ee) noexcept {
+    for (auto error = ee.get(); error; error = error->next.get()) {
+        if (error->request) {
+            error->request->share();
+        }
+    }
+}
+
 /** \brief constructs smart pointer to the extened error */
 ROTOR_API extended_error_ptr_t make_error(const std::string &context_, const std::error_code &ec_,
                                           const extended_error_ptr_t &next_ = {},
@@ -48,6 +48,7 @@ struct ROTOR_FLTK_API supervisor_fltk_t : public supervisor_t {
     void start() noexcept override;
     void shutdown() noexcept override;
     void enqueue(message_ptr_t message) noexcept override;
+    void enqueue_batch(messages_queue_t &messages) noexcept override;
 
     /** \brief generic non-public fields accessor */
     template <typename T> auto &access() noexcept;
@@ -77,7 +78,7 @@ struct ROTOR_FLTK_API supervisor_fltk_t : public supervisor_t {
     using timers_map_t = std::unordered_map<request_id_t, timer_ptr_t>;
 
     void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    void do_cancel_timer(request_id_t timer_id) noexcept override;
+    void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
 
     /** \brief timer id to timer pointer mapping */
     timers_map_t timers_map;
@@ -23,6 +23,7 @@ struct ROTOR_FLTK_API system_context_fltk_t : system_context_t {
 
   private:
     void enqueue(message_ptr_t message) noexcept;
+    void enqueue_batch(messages_queue_t &messages) noexcept;
     friend supervisor_fltk_t;
 };
 
@@ -119,6 +119,9 @@ template <typename M, typename H> struct handler_traits<lambda_holder_t<M, H>> {
  * It holds reference to {@link actor_base_t}.
  */
 struct ROTOR_API handler_base_t : public arc_base_t<handler_base_t> {
+    /** \brief non-virtual entry point for the messages, which are known to match the handler */
+    using dispatcher_t = void (*)(handler_base_t &, message_ptr_t &) noexcept;
+
     /** \brief pointer to unique handler type ( `typeid(Handler).name()` ) */
     const void *handler_type;
 
@@ -128,10 +131,16 @@ struct ROTOR_API handler_base_t : public arc_base_t<handler_base_t> {
     /** \brief precalculated hash for the handler */
     size_t precalc_hash;
 
+    /** \brief the message delivery function of the handler, see `dispatch` */
+    const dispatcher_t dispatcher;
+
     /** \brief constructs `handler_base_t` from raw pointer to actor, raw
      * pointer to message type and raw pointer to handler type
+     *
+     * The default dispatcher just performs virtual `call`.
      */
-    explicit handler_base_t(actor_base_t &actor, const void *handler_type_) noexcept;
+    explicit handler_base_t(actor_base_t &actor, const void *handler_type_,
+                            dispatcher_t dispatcher_ = &handler_base_t::call_virtual) noexcept;
 
     /** \brief compare two handler for equality */
     inline bool operator==(const handler_base_t &rhs) const noexcept {
@@ -167,6 +176,18 @@ struct ROTOR_API handler_base_t : public arc_base_t<handler_base_t> {
 
     /** \brief unique per-message-type pointer used for routing */
     virtual const void *message_type() const noexcept = 0;
+
+    /** \brief delivers the message, which is known to match the handler message type
+     *
+     * This is the hot path of the message delivery: the subscription lookup already
+     * has filtered the handlers by message type, so the type is not re-checked and the
+     * call is a single indirect call (the concrete handlers supply statically typed
+     * dispatcher). Unlike `call_no_check`, the intercepted handlers are still intercepted.
+     */
+    inline void dispatch(message_ptr_t &message) noexcept { dispatcher(*this, message); }
+
+  private:
+    static void call_virtual(handler_base_t &self, message_ptr_t &message) noexcept;
 };
 
 /** \struct continuation_t
@@ -193,6 +214,8 @@ struct handler_intercepted_t : public handler_base_t {
     const void *message_type() const noexcept override;
 
   private:
+    static void intercept(handler_base_t &self, message_ptr_t &message) noexcept;
+
     handler_ptr_t backend;
     const void *tag;
 };
@@ -238,13 +261,11 @@ struct handler_t<Handler, std::enable_if_t<details::is_actor_handler_v<Handler>>
 
     /** \brief constructs handler from actor & pointer-to-member function  */
     explicit handler_t(actor_base_t &actor, Handler &&handler_)
-        : handler_base_t{actor, handler_type}, handler{handler_} {}
+        : handler_base_t{actor, handler_type, &handler_t::invoke}, handler{handler_} {}
 
     void call(message_ptr_t &message) noexcept override {
         if (message->type_index == final_message_t::message_type) {
-            auto final_message = static_cast<final_message_t *>(message.get());
-            auto &final_obj = static_cast<backend_t &>(*actor_ptr);
-            (final_obj.*handler)(*final_message);
+            invoke(*this, message);
         }
     }
 
@@ -252,11 +273,7 @@ struct handler_t<Handler, std::enable_if_t<details::is_actor_handler_v<Handler>>
         return message->type_index == final_message_t::message_type;
     }
 
-    void call_no_check(message_ptr_t &message) noexcept override {
-        auto final_message = static_cast<final_message_t *>(message.get());
-        auto &final_obj = static_cast<backend_t &>(*actor_ptr);
-        (final_obj.*handler)(*final_message);
-    }
+    void call_no_check(message_ptr_t &message) noexcept override { invoke(*this, message); }
 
     const void *message_type() const noexcept override { return final_message_t::message_type; }
 
@@ -264,6 +281,13 @@ struct handler_t<Handler, std::enable_if_t<details::is_actor_handler_v<Handler>>
     using traits = handler_traits<Handler>;
     using backend_t = typename traits::backend_t;
     using final_message_t = typename traits::message_t;
+
+    static void invoke(handler_base_t &self, message_ptr_t &message) noexcept {
+        auto &final_handler = static_cast<handler_t &>(self);
+        auto final_message = static_cast<final_message_t *>(message.get());
+        auto &final_obj = static_cast<backend_t &>(*final_handler.actor_ptr);
+        (final_obj.*final_handler.handler)(*final_message);
+    }
 };
 
 template <typename Handler>
@@ -286,13 +310,12 @@ struct handler_t<Handler, std::enable_if_t<details::is_plugin_handler_v<Handler>
 
     /** \brief ctor form plugin and plugin handler (pointer-to-member function of the plugin) */
     explicit handler_t(plugin::plugin_base_t &plugin_, Handler &&handler_)
-        : handler_base_t{*plugin_.access<details::to::actor>(), handler_type}, plugin{plugin_}, handler{handler_} {}
+        : handler_base_t{*plugin_.access<details::to::actor>(), handler_type, &handler_t::invoke}, plugin{plugin_},
+          handler{handler_} {}
 
     void call(message_ptr_t &message) noexcept override {
         if (message->type_index == final_message_t::message_type) {
-            auto final_message = static_cast<final_message_t *>(message.get());
-            auto &final_obj = static_cast<backend_t &>(plugin);
-            (final_obj.*handler)(*final_message);
+            invoke(*this, message);
         }
     }
 
@@ -300,11 +323,7 @@ struct handler_t<Handler, std::enable_if_t<details::is_plugin_handler_v<Handler>
         return message->type_index == final_message_t::message_type;
     }
 
-    void call_no_check(message_ptr_t &message) noexcept override {
-        auto final_message = static_cast<final_message_t *>(message.get());
-        auto &final_obj = static_cast<backend_t &>(plugin);
-        (final_obj.*handler)(*final_message);
-    }
+    void call_no_check(message_ptr_t &message) noexcept override { invoke(*this, message); }
 
     const void *message_type() const noexcept override { return final_message_t::message_type; }
 
@@ -312,6 +331,13 @@ struct handler_t<Handler, std::enable_if_t<details::is_plugin_handler_v<Handler>
     using traits = handler_traits<Handler>;
     using backend_t = typename traits::backend_t;
     using final_message_t = typename traits::message_t;
+
+    static void invoke(handler_base_t &self, message_ptr_t &message) noexcept {
+        auto &final_handler = static_cast<handler_t &>(self);
+        auto final_message = static_cast<final_message_t *>(message.get());
+        auto &final_obj = static_cast<backend_t &>(final_handler.plugin);
+        (final_obj.*final_handler.handler)(*final_message);
+    }
 };
 
 template <typename Handler>
@@ -336,12 +362,11 @@ struct handler_t<lambda_holder_t<Handler, M>,
 
     /** \brief constructs handler from actor & lambda wrapper */
     explicit handler_t(actor_base_t &actor, handler_backend_t &&handler_)
-        : handler_base_t{actor, handler_type}, handler{std::forward<handler_backend_t>(handler_)} {}
+        : handler_base_t{actor, handler_type, &handler_t::invoke}, handler{std::forward<handler_backend_t>(handler_)} {}
 
     void call(message_ptr_t &message) noexcept override {
         if (message->type_index == final_message_t::message_type) {
-            auto final_message = static_cast<final_message_t *>(message.get());
-            handler.fn(*final_message);
+            invoke(*this, message);
         }
     }
 
@@ -349,15 +374,17 @@ struct handler_t<lambda_holder_t<Handler, M>,
         return message->type_index == final_message_t::message_type;
     }
 
-    void call_no_check(message_ptr_t &message) noexcept override {
-        auto final_message = static_cast<final_message_t *>(message.get());
-        handler.fn(*final_message);
-    }
+    void call_no_check(message_ptr_t &message) noexcept override { invoke(*this, message); }
 
     const void *message_type() const noexcept override { return final_message_t::message_type; }
 
   private:
     using final_message_t = typename handler_backend_t::message_t;
+
+    static void invoke(handler_base_t &self, message_ptr_t &message) noexcept {
+        auto final_message = static_cast<final_message_t *>(message.get());
+        static_cast<handler_t &>(self).handler.fn(*final_message);
+    }
 };
 
 template <typename Handler, typename M>
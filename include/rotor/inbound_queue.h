@@ -0,0 +1,126 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "message.h"
+#include "delivery_stats.h"
+#include <atomic>
+#include <boost/lockfree/queue.hpp>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rotor {
+
+/** \struct inbound_queue_t
+ *  \brief multiple producers single consumer queue for the messages from other localities
+ *
+ * There are two implementations, selected at construction time:
+ *
+ * - `boost::lockfree::queue` of message pointers (default), where each
+ * push and each pop performs CAS operation;
+ *
+ * - intrusive queue, where messages are linked via `message_base_t::next_inbound`
+ * into lock-free stack. Producers still use CAS to push a message, however
+ * the consumer detaches all pushed messages with a single atomic exchange,
+ * and then pops them one by one (in FIFO order) without any synchronization.
+ *
+ * The queue takes ownership of the pushed raw pointers, i.e. messages should be
+ * `detach()`-ed before pushing.
+ *
+ * The `pop()` and `empty()` methods must be invoked from consumer thread only.
+ *
+ */
+struct ROTOR_API inbound_queue_t {
+    /** \brief constructs queue of the specified implementation */
+    inbound_queue_t(bool intrusive_ = false);
+
+    inbound_queue_t(const inbound_queue_t &) = delete;
+    inbound_queue_t(inbound_queue_t &&) = delete;
+
+    /** \brief releases all messages, still stored in the queue */
+    ~inbound_queue_t();
+
+    /** \brief preallocates nodes of the lock-free queue (no-op for intrusive queue) */
+    void reserve_unsafe(std::size_t size);
+
+    /** \brief pushes message into the queue, can be invoked from any thread
+     *
+     * The message is shared, as it will be released by the consumer thread.
+     */
+    inline void push(message_base_t *message) noexcept {
+        message->share();
+        if (intrusive) {
+            auto head = stack.load(std::memory_order_relaxed);
+            do {
+                message->next_inbound = head;
+            } while (!stack.compare_exchange_weak(head, message, std::memory_order_release, std::memory_order_relaxed));
+        } else {
+            queue.push(message);
+        }
+    }
+
+    /** \brief pops message from the queue; returns `false` if there are no messages */
+    inline bool pop(message_base_t *&message) noexcept {
+        auto result = take(message);
+#if defined(ROTOR_DELIVERY_STATS)
+        if (result && stats) {
+            stats->on_inbound_pop();
+        }
+#endif
+        return result;
+    }
+
+    /** \brief returns `true` if there are no messages in the queue */
+    inline bool empty() const noexcept {
+        if (intrusive) {
+            return !batch && !stack.load(std::memory_order_acquire);
+        }
+        return queue.empty();
+    }
+
+    /** \brief returns `true` if the queue is intrusive */
+    inline bool is_intrusive() const noexcept { return intrusive; }
+
+    /** \brief non-owning pointer to the delivery statistics of the consumer (might be `nullptr`) */
+    delivery_stats_t *stats = nullptr;
+
+  private:
+    using queue_t = boost::lockfree::queue<message_base_t *>;
+
+    inline bool take(message_base_t *&message) noexcept {
+        if (intrusive) {
+            if (!batch) {
+                batch = detach_batch();
+                if (!batch) {
+                    return false;
+                }
+            }
+            message = batch;
+            batch = message->next_inbound;
+            message->next_inbound = nullptr;
+            return true;
+        }
+        return queue.pop(message);
+    }
+
+    /** \brief atomically takes all pushed messages and returns them in FIFO order */
+    message_base_t *detach_batch() noexcept;
+
+    bool intrusive;
+    queue_t queue;
+    std::atomic<message_base_t *> stack;
+    message_base_t *batch;
+};
+
+} // namespace rotor
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
@@ -8,8 +8,13 @@
 
 #include "arc.hpp"
 #include "address.hpp"
+#include "message_pool.h"
+#include <atomic>
 #include <typeindex>
-#include <deque>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -20,6 +25,31 @@ namespace rotor {
 
 struct message_base_t;
 
+/** \brief dense numeric message type identifier, see `message_base_t::type_id` */
+using message_type_id_t = std::uint32_t;
+
+namespace message_support {
+ROTOR_API const void *register_type(const std::type_index &type_index) noexcept;
+
+/** \brief returns dense numeric identifier of the message type, registering it if needed
+ *
+ * The identifiers are assigned sequentially starting from `1` in the order of
+ * the types registration; the `0` value is reserved for the messages without identifier.
+ */
+ROTOR_API message_type_id_t register_type_id(const std::type_index &type_index) noexcept;
+
+/** \brief returns the upper bound (exclusive) of the currently registered message type ids
+ *
+ * It is suitable for sizing the arrays, indexed by message type id. As message types
+ * might be registered later (e.g. upon shared library loading), the arrays should be
+ * resized, if the id of a message is out of bounds.
+ */
+ROTOR_API message_type_id_t type_ids_bound() noexcept;
+
+/** \brief destroys pooled message and returns its memory block into the pool */
+ROTOR_API void release_pooled(const message_base_t *message) noexcept;
+} // namespace message_support
+
 /** \struct message_visitor_t
  *  \brief Abstract message visitor interface
  *
@@ -48,8 +78,18 @@ struct ROTOR_API message_visitor_t {
  *
  * The actual message payload meant to be provided by derived classes
  *
+ * The message carries its own ref-counter (with the same policy as `arc_base_t`),
+ * which, upon reaching zero, either deletes the message or returns it into
+ * the pool, the message has been allocated from.
+ *
+ * When the library is built with `ROTOR_REFCOUNT_HYBRID`, the ref-counter
+ * is non-atomic while the message is confined to the thread, which created
+ * it, and it becomes atomic once the message is shared (see `share()`).
+ * Payloads, which hold pointers to other messages, must provide `share_nested`
+ * overload, otherwise the nested messages are never shared.
+ *
  */
-struct message_base_t : public arc_base_t<message_base_t> {
+struct message_base_t {
     virtual ~message_base_t() = default;
 
     /**
@@ -61,20 +101,144 @@ struct message_base_t : public arc_base_t<message_base_t> {
      */
     const void *type_index;
 
+    /** \brief dense numeric message type identifier
+     *
+     * It matches the message type 1:1 (as `type_index` does), but, unlike the pointer,
+     * it is small and dense, i.e. it can be used as index in dispatching tables.
+     *
+     */
+    const message_type_id_t type_id;
+
     /** \brief message destination address */
     address_ptr_t address;
 
     /** \brief post-delivery destination address, see `make_routed_message()` for usage */
     address_ptr_t next_route;
 
-    /** \brief constructor which takes destination address */
-    inline message_base_t(const void *type_index_, const address_ptr_t &addr)
-        : type_index(type_index_), address{addr} {}
+    /** \brief non-owning pointer to the pool, the message has been allocated from
+     *
+     * It is `nullptr` for heap-allocated messages.
+     */
+    message_pool_t *pool = nullptr;
+
+    /** \brief intrusive link to the next message in the inbound queue (internal) */
+    message_base_t *next_inbound = nullptr;
+
+    /** \brief constructor which takes message type, destination address and (optionally) message type id */
+    inline message_base_t(const void *type_index_, const address_ptr_t &addr, message_type_id_t type_id_ = 0)
+        : type_index(type_index_), type_id{type_id_}, address{addr}, ref_counter{0} {}
+
+    /** \brief marks the message as the one, which can be accessed from multiple threads
+     *
+     * With `ROTOR_REFCOUNT_HYBRID` all further reference counter updates of the message
+     * (and of the messages, referenced from its payload) become atomic. The message must
+     * be shared before it is handed to an other thread; rotor does that when the message
+     * is enqueued to a supervisor. User code should share the message only if it passes
+     * the message pointer to other threads bypassing supervisors.
+     *
+     * Otherwise the method does nothing.
+     */
+    inline void share() const noexcept {
+#if defined(ROTOR_REFCOUNT_HYBRID)
+        if (!shared) {
+            shared = true;
+            share_payload();
+        }
+#endif
+    }
+
+#if defined(ROTOR_REFCOUNT_HYBRID)
+    /** \brief returns `true` if the message has been shared, see `share()` */
+    inline bool is_shared() const noexcept { return shared; }
+
+    /** \brief returns the current value of the reference counter */
+    inline unsigned int use_count() const noexcept { return ref_counter.load(std::memory_order_relaxed); }
+
+    /** \brief increments reference counter of the message */
+    friend inline void intrusive_ptr_add_ref(const message_base_t *message) noexcept {
+        auto &counter = message->ref_counter;
+        if (message->shared) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /** \brief decrements reference counter and disposes the message when it reaches zero */
+    friend inline void intrusive_ptr_release(const message_base_t *message) noexcept {
+        auto &counter = message->ref_counter;
+        unsigned int value;
+        if (message->shared) {
+            value = counter.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        } else {
+            value = counter.load(std::memory_order_relaxed) - 1;
+            counter.store(value, std::memory_order_relaxed);
+        }
+        if (value == 0) {
+            dispose(message);
+        }
+    }
+#else
+    /** \brief returns the current value of the reference counter */
+    inline unsigned int use_count() const noexcept { return counter_policy_t::load(ref_counter); }
+
+    /** \brief increments reference counter of the message */
+    friend inline void intrusive_ptr_add_ref(const message_base_t *message) noexcept {
+        counter_policy_t::increment(message->ref_counter);
+    }
+
+    /** \brief decrements reference counter and disposes the message when it reaches zero */
+    friend inline void intrusive_ptr_release(const message_base_t *message) noexcept {
+        if (counter_policy_t::decrement(message->ref_counter) == 0) {
+            dispose(message);
+        }
+    }
+#endif
+
+  protected:
+    /** \brief shares the messages, referenced from the payload (if any), see `share_nested` */
+    virtual void share_payload() const noexcept {}
+
+  private:
+    static inline void dispose(const message_base_t *message) noexcept {
+        if (!message->pool) {
+            delete message;
+        } else {
+            message_support::release_pooled(message);
+        }
+    }
+
+#if defined(ROTOR_REFCOUNT_HYBRID)
+    mutable std::atomic<unsigned int> ref_counter;
+    mutable bool shared = false;
+#else
+    mutable counter_policy_t::type ref_counter;
+#endif
 };
 
-namespace message_support {
-ROTOR_API const void *register_type(const std::type_index &type_index) noexcept;
-}
+/** \brief shares the messages, referenced from the payload of a message
+ *
+ * The default implementation does nothing. User payload types, which hold
+ * `message_ptr_t` (or other intrusive pointers to messages), MUST provide an
+ * overload in the payload namespace, which invokes `share()` on the referenced
+ * messages; it is found via ADL, e.g.
+ *
+ * ```
+ * namespace my {
+ * struct payload_t { rotor::message_ptr_t original; };
+ * inline void share_nested(const payload_t &p) noexcept { if (p.original) p.original->share(); }
+ * }
+ * ```
+ *
+ * Payloads holding `extended_error_ptr_t` should invoke `share_requests()` on it,
+ * as the errors might reference the request messages.
+ *
+ * With `ROTOR_REFCOUNT_HYBRID` a missing overload is not detected: the nested
+ * message keeps non-atomic reference counter and it is silently raced, when the
+ * outer message crosses thread boundary. Without `ROTOR_REFCOUNT_HYBRID` the
+ * overloads are no-ops.
+ */
+template <typename T> inline void share_nested(const T &) noexcept {}
 
 /** \struct message_t
  *  \brief the generic message meant to hold user-specific payload
@@ -103,22 +267,163 @@ template <typename T> struct message_t : public message_base_t {
     /** \brief forwards `args` for payload construction */
     template <typename... Args>
     message_t(const address_ptr_t &addr, Args &&...args)
-        : message_base_t{message_type, addr}, payload{std::forward<Args>(args)...} {}
+        : message_base_t{message_type, addr, message_type_id}, payload{std::forward<Args>(args)...} {}
 
     /** \brief user-defined payload */
     T payload;
 
     /** \brief unique per-message-type pointer used for routing */
     static const void *message_type;
+
+    /** \brief dense numeric identifier of the message type */
+    static const message_type_id_t message_type_id;
+
+  protected:
+    void share_payload() const noexcept override { share_nested(payload); }
 };
 
 template <typename T> const void *message_t<T>::message_type = message_support::register_type(typeid(message_t<T>));
 
+template <typename T>
+const message_type_id_t message_t<T>::message_type_id = message_support::register_type_id(typeid(message_t<T>));
+
 /** \brief intrusive pointer for message */
 using message_ptr_t = intrusive_ptr_t<message_base_t>;
 
-/** \brief structure to hold messages (intrusive pointers) */
-using messages_queue_t = std::deque<message_ptr_t>;
+/** \struct messages_queue_t
+ *  \brief growable power-of-two ring buffer of messages
+ *
+ * The queue holds a reference to each of the stored messages, which is
+ * released upon `pop_front()`/`pop_back()` or upon the queue destruction;
+ * `take_front()`/`take_back()` transfer the reference to the caller.
+ *
+ * Unlike `std::deque`, the storage is a single contiguous chunk, which
+ * grows (doubles) when it is full and never shrinks, i.e. there are no
+ * allocations when the queue "breathes" within its capacity.
+ *
+ */
+struct ROTOR_API messages_queue_t {
+    /** \brief type of the queue element */
+    using value_type = message_ptr_t;
+
+    messages_queue_t() noexcept = default;
+
+    /** \brief copies the queue, i.e. the messages become shared by both queues */
+    messages_queue_t(const messages_queue_t &other);
+
+    /** \brief takes all messages (and the storage) from the other queue */
+    messages_queue_t(messages_queue_t &&other) noexcept;
+
+    /** \brief releases own messages and copies the messages of the other queue */
+    messages_queue_t &operator=(const messages_queue_t &other);
+
+    /** \brief releases own messages and takes all messages (and the storage) from the other queue */
+    messages_queue_t &operator=(messages_queue_t &&other) noexcept;
+
+    /** \brief returns amount of messages in the queue */
+    inline std::size_t size() const noexcept { return tail - head; }
+
+    /** \brief returns `true` if there are no messages in the queue */
+    inline bool empty() const noexcept { return tail == head; }
+
+    /** \brief returns the first message in the queue (the queue must not be empty) */
+    inline value_type &front() noexcept { return slots[head & mask]; }
+
+    /** \brief returns the first message in the queue (the queue must not be empty) */
+    inline const value_type &front() const noexcept { return slots[head & mask]; }
+
+    /** \brief returns the last message in the queue (the queue must not be empty) */
+    inline value_type &back() noexcept { return slots[(tail - 1) & mask]; }
+
+    /** \brief returns the last message in the queue (the queue must not be empty) */
+    inline const value_type &back() const noexcept { return slots[(tail - 1) & mask]; }
+
+    /** \brief returns the message at the specified position from the beginning of the queue */
+    inline value_type &operator[](std::size_t index) noexcept { return slots[(head + index) & mask]; }
+
+    /** \brief returns the message at the specified position from the beginning of the queue */
+    inline const value_type &operator[](std::size_t index) const noexcept { return slots[(head + index) & mask]; }
+
+    /** \brief appends message to the end of the queue */
+    inline void push_back(message_ptr_t message) {
+        if (size() == capacity) {
+            grow();
+        }
+        slots[tail++ & mask] = std::move(message);
+    }
+
+    /** \brief prepends message to the beginning of the queue */
+    inline void push_front(message_ptr_t message) {
+        if (size() == capacity) {
+            grow();
+        }
+        slots[--head & mask] = std::move(message);
+    }
+
+    /** \brief constructs message pointer from the args and appends it to the end of the queue */
+    template <typename... Args> inline void emplace_back(Args &&...args) {
+        push_back(message_ptr_t(std::forward<Args>(args)...));
+    }
+
+    /** \brief removes the first message and transfers its ownership to the caller */
+    inline message_ptr_t take_front() noexcept { return std::move(slots[head++ & mask]); }
+
+    /** \brief removes the last message and transfers its ownership to the caller */
+    inline message_ptr_t take_back() noexcept { return std::move(slots[--tail & mask]); }
+
+    /** \brief removes and releases the first message */
+    inline void pop_front() noexcept { take_front(); }
+
+    /** \brief removes and releases the last message */
+    inline void pop_back() noexcept { take_back(); }
+
+    /** \brief releases all messages, the storage is kept */
+    inline void clear() noexcept {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+  private:
+    using slots_t = std::unique_ptr<value_type[]>;
+
+    void grow();
+
+    slots_t slots;
+    std::size_t capacity = 0;
+    std::size_t mask = 0;
+    std::size_t head = 0;
+    std::size_t tail = 0;
+};
+
+namespace message_support {
+
+/** \brief constructs message of the final type in the pool memory
+ *
+ * If there is no pool or the message type does not fit into the pool,
+ * the message is allocated on heap.
+ */
+template <typename Message, typename... Args> Message *construct(message_pool_t *pool, Args &&...args) {
+    constexpr bool poolable =
+        sizeof(Message) <= message_pool_t::max_size && alignof(Message) <= message_pool_t::alignment;
+    if constexpr (poolable) {
+        if (pool) {
+            auto memory = pool->allocate(sizeof(Message));
+            Message *message;
+            try {
+                message = new (memory) Message(std::forward<Args>(args)...);
+            } catch (...) {
+                pool->deallocate(memory);
+                throw;
+            }
+            message->pool = pool;
+            return message;
+        }
+    }
+    return new Message(std::forward<Args>(args)...);
+}
+
+} // namespace message_support
 
 /** \brief constructs message by constructing it's payload; intrusive pointer for the message is returned */
 template <typename M, typename... Args> auto make_message(const address_ptr_t &addr, Args &&...args) -> message_ptr_t {
@@ -126,6 +431,17 @@ template <typename M, typename... Args> auto make_message(const address_ptr_t &a
     return message_ptr_t{new message_t<M>(addr, std::forward<Args>(args)...)};
 }
 
+/** \brief constructs message by constructing it's payload in the memory of the pool;
+ * intrusive pointer for the message is returned
+ *
+ * If the pool is `nullptr` the message is allocated on heap, i.e. it is the same as `make_message`.
+ */
+template <typename M, typename... Args>
+auto make_pooled_message(message_pool_t *pool, const address_ptr_t &addr, Args &&...args) -> message_ptr_t {
+    assert(addr);
+    return message_ptr_t{message_support::construct<message_t<M>>(pool, addr, std::forward<Args>(args)...)};
+}
+
 /** \brief constructs message by constructing it's payload; after delivery to destination address
  *  (to all subscribers), the message is routed the specified route_addr; intrusive pointer for the message is returned
  *
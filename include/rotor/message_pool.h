@@ -0,0 +1,127 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "arc.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rotor {
+
+/** \struct message_pool_t
+ *  \brief size-classed free-list allocator for messages of a locality
+ *
+ * The pool is owned by locality leader and it is shared by all supervisors
+ * of the locality. Memory blocks are never returned to the heap while the pool
+ * is alive, instead they are kept in per-size-class free lists for reuse.
+ *
+ * Allocation is thread-unsafe and must be performed in the locality context only.
+ *
+ * Deallocation might happen on any thread: if a message is released while
+ * its locality processes messages (see `guard_t`), the block is returned directly
+ * into the free list, otherwise it is pushed into the lock-free return stack,
+ * which is drained by the next allocation.
+ *
+ * Pooled messages do not hold references to the pool, instead the pool counts
+ * its outstanding blocks. Once the last owner (supervisor) releases the pool,
+ * it is destroyed immediately if there are no outstanding blocks; otherwise
+ * it is orphaned and destroyed upon the release of the last outstanding block.
+ *
+ */
+struct ROTOR_API message_pool_t {
+    /** \brief size step between two adjacent size classes */
+    static constexpr std::size_t granularity = 32;
+
+    /** \brief amount of size classes */
+    static constexpr std::size_t size_classes = 16;
+
+    /** \brief max object size, which can be allocated from the pool */
+    static constexpr std::size_t max_size = granularity * size_classes;
+
+    /** \brief guaranteed alignment of the allocated memory */
+    static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    /** \struct guard_t
+     *  \brief marks the current thread as the one, which executes the pool locality
+     *
+     * While the guard is alive, the released messages of the pool are returned into
+     * the free lists without synchronization.
+     */
+    struct ROTOR_API guard_t {
+        /** \brief marks the current thread as executing the pool locality */
+        guard_t(message_pool_t *pool) noexcept;
+
+        /** \brief restores the previous mark of the current thread */
+        ~guard_t();
+
+        guard_t(const guard_t &) = delete;
+        guard_t(guard_t &&) = delete;
+
+      private:
+        message_pool_t *previous;
+    };
+
+    message_pool_t() noexcept;
+    message_pool_t(const message_pool_t &) = delete;
+    message_pool_t(message_pool_t &&) = delete;
+
+    /** \brief returns memory block of at least the specified size
+     *
+     * If the size exceeds `max_size`, then `nullptr` is returned.
+     */
+    void *allocate(std::size_t size);
+
+    /** \brief returns previously allocated memory block into the pool */
+    void deallocate(void *ptr) noexcept;
+
+    /** \brief returns the pool of the locality, executed by the current thread (if any), see `guard_t` */
+    static message_pool_t *current() noexcept;
+
+    /** \brief adds owner reference to the pool */
+    friend ROTOR_API void intrusive_ptr_add_ref(message_pool_t *pool) noexcept;
+
+    /** \brief releases owner reference, the last release orphans the pool */
+    friend ROTOR_API void intrusive_ptr_release(message_pool_t *pool) noexcept;
+
+  private:
+    struct alignas(alignment) block_t {
+        block_t *next;
+        std::size_t size_class;
+    };
+
+    using free_lists_t = std::array<block_t *, size_classes>;
+    using counter_t = counter_policy_t::type;
+
+    static block_t *const orphaned_mark;
+
+    ~message_pool_t();
+
+    void reclaim() noexcept;
+    void give_back(block_t *block) noexcept;
+    void orphan() noexcept;
+
+    counter_t owners;
+    free_lists_t free_lists;
+    std::size_t outstanding;
+    std::atomic<block_t *> returned;
+    std::atomic<std::size_t> remaining;
+};
+
+/** \brief intrusive pointer for message pool */
+using message_pool_ptr_t = intrusive_ptr_t<message_pool_t>;
+
+} // namespace rotor
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
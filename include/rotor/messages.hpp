@@ -96,6 +96,9 @@ struct shutdown_trigger_t {
         : actor_address(std::forward<Address>(address_)), reason(std::forward<Reason>(reason_)) {}
 };
 
+/** \brief shares the requests, referenced from the shutdown reason */
+inline void share_nested(const shutdown_trigger_t &payload) noexcept { share_requests(payload.reason); }
+
 /** \struct shutdown_confirmation_t
  *  \brief Message with this payload is sent from an actor to its supervisor to
  * confirm successful shutdown.
@@ -118,6 +121,9 @@ struct shutdown_request_t {
     extended_error_ptr_t reason;
 };
 
+/** \brief shares the requests, referenced from the shutdown reason */
+inline void share_nested(const shutdown_request_t &payload) noexcept { share_requests(payload.reason); }
+
 /** \struct handler_call_t
  *  \brief Message with this payload is forwarded to the handler's supervisor for
  * the delivery of the original message.
@@ -141,6 +147,9 @@ struct handler_call_t {
     handler_ptr_t handler;
 };
 
+/** \brief shares the original message along with the handler call */
+inline void share_nested(const handler_call_t &payload) noexcept { payload.orig_message->share(); }
+
 /** \struct external_subscription_t
  *  \brief Message with this payload is forwarded to the target address supervisor
  * for recording subscription in the external (foreign) handler
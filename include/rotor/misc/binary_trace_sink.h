@@ -0,0 +1,146 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "../trace_sink.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rotor::misc {
+
+/** \struct trace_file_header_t
+ *  \brief the header of the binary trace file
+ *
+ * The file consists of the header, followed by the table of message type
+ * names (`max_types` entries of `trace_type_name_t`, indexed by message type id),
+ * followed by the names area of `names_capacity` bytes, followed by the ring of
+ * `capacity` records. The `written` field is the total amount of records ever
+ * written, i.e. the oldest record in the ring is at `written % capacity` position
+ * once the ring is wrapped around.
+ */
+struct trace_file_header_t {
+    /** \brief the expected `magic` value */
+    static constexpr std::uint64_t magic_value = 0x3245434152544F52ull; // "ROTRACE2"
+
+    /** \brief the default budget of the names area per message type */
+    static constexpr std::size_t type_name_size = 128;
+
+    /** \brief file type identifier */
+    std::uint64_t magic;
+
+    /** \brief size of `trace_record_t`, written by the recorder */
+    std::uint32_t record_size;
+
+    /** \brief amount of the type name slots */
+    std::uint32_t max_types;
+
+    /** \brief amount of records in the ring */
+    std::uint64_t capacity;
+
+    /** \brief total amount of the recorded messages */
+    std::uint64_t written;
+
+    /** \brief size of the names area */
+    std::uint64_t names_capacity;
+
+    /** \brief amount of the used bytes of the names area */
+    std::uint64_t names_used;
+};
+
+/** \struct trace_type_name_t
+ *  \brief location of the (mangled) message type name in the names area
+ *
+ * The names are stored without truncation and without terminating zero. If
+ * the name does not fit into the rest of the names area, the `offset` is set
+ * to `lost_offset`, i.e. the decoder can report it instead of printing garbage.
+ */
+struct trace_type_name_t {
+    /** \brief the `offset` value of the name, which did not fit into the names area */
+    static constexpr std::uint32_t lost_offset = 0xFFFFFFFFu;
+
+    /** \brief offset of the name in the names area */
+    std::uint32_t offset;
+
+    /** \brief length of the name (zero if the message type has not been met) */
+    std::uint32_t length;
+};
+
+/** \struct trace_record_t
+ *  \brief fixed-size record of a message processing by a supervisor */
+struct trace_record_t {
+    /** \brief steady clock time point in nanoseconds */
+    std::uint64_t timestamp;
+
+    /** \brief the supervisor (memory location), which processed the message */
+    std::uint64_t supervisor;
+
+    /** \brief the message destination address (memory location) */
+    std::uint64_t address;
+
+    /** \brief message type id, see `message_base_t::type_id` */
+    std::uint32_t type_id;
+
+    /** \brief amount of the messages left in the supervisor queue */
+    std::uint32_t queue_depth;
+
+    /** \brief the `trace_event_t` value */
+    std::uint32_t event;
+
+    /** \brief unused */
+    std::uint32_t reserved;
+};
+
+/** \struct binary_trace_sink_t
+ *  \brief records messages processing into memory-mapped ring file
+ *
+ * Each recorded message takes a fixed-size record, without any formatting and
+ * allocations, i.e. it is suitable for capturing full-rate traces. The message
+ * type name is written to the file only when the type is met the first time.
+ *
+ * The sink is intended to be used by the single locality leader (one file per
+ * locality). The file can be decoded offline (see `examples/trace_decode.cpp`).
+ *
+ */
+struct ROTOR_API binary_trace_sink_t : trace_sink_t {
+    /** \brief creates (truncates) the trace file with the ring of `capacity` records
+     *
+     * The `names_capacity` is the size of the area for the message type names.
+     *
+     * Throws an exception if the file cannot be created or mapped into memory.
+     */
+    binary_trace_sink_t(const std::string &path, std::size_t capacity, std::uint32_t max_types = 1024,
+                        std::size_t names_capacity = 1024 * trace_file_header_t::type_name_size);
+    ~binary_trace_sink_t();
+
+    void record(const supervisor_t &supervisor, const message_base_t &message, trace_event_t event,
+                std::size_t queue_depth) noexcept override;
+
+  private:
+    struct mapping_t;
+    using mapping_ptr_t = std::unique_ptr<mapping_t>;
+
+    mapping_ptr_t mapping;
+    trace_file_header_t *header;
+    trace_type_name_t *type_names;
+    char *names;
+    trace_record_t *records;
+    std::vector<bool> known_types;
+};
+
+} // namespace rotor::misc
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
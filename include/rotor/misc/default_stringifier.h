@@ -8,6 +8,7 @@
 
 #include "../messages.hpp"
 #include "../message_stringifier.h"
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -94,6 +95,16 @@ struct ROTOR_API default_stringifier_t : message_stringifier_t,
     void on(const message::unlink_notify_t &, void *) override;
     void on(const message::unlink_request_t &, void *) override;
     void on(const message::unlink_response_t &, void *) override;
+
+    /** \brief visits the message of the concrete type */
+    using visit_fn_t = void (*)(default_stringifier_t &, const message_base_t &, void *);
+
+    /** \brief visitors of rotor messages, indexed by message type id */
+    using visitors_t = std::vector<visit_fn_t>;
+
+    template <typename Message> static void visit(default_stringifier_t &, const message_base_t &, void *);
+    template <typename... Messages> static visitors_t make_visitors() noexcept;
+    static const visitors_t &get_visitors() noexcept;
 };
 
 } // namespace misc
@@ -8,7 +8,12 @@
 
 #include "plugin_base.h"
 #include "../message_stringifier.h"
+#include "../trace_sink.h"
+#include "../delivery_stats.h"
+#include <atomic>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #if !defined(NDEBUG) && !defined(ROTOR_DEBUG_DELIVERY)
 #define ROTOR_DO_DELIVERY_DEBUG 1
@@ -38,15 +43,23 @@ struct ROTOR_API local_delivery_t {
 /** \struct inspected_local_delivery_t
  *
  * \brief debugging local message delivery implementation with dumping details to stdout.
+ *
+ * The message is dumped if its level does not exceed the threshold, which is taken
+ * from `ROTOR_INSPECT_DELIVERY` environment variable upon delivery plugin activation.
+ * The levels of rotor messages are looked up by message type id in a table; user
+ * messages have the level `0`.
  */
 struct ROTOR_API inspected_local_delivery_t {
 
     /** \brief delivers the message to the recipients, possibly dumping it to console */
     static void delivery(message_ptr_t &message, const subscription_t::joint_handlers_t &local_recipients,
-                         const message_stringifier_t *stringifier) noexcept;
+                         const message_stringifier_t *stringifier, int threshold) noexcept;
 
     /** \brief dumps discarded message */
-    static void discard(message_ptr_t &message, const message_stringifier_t *stringifier) noexcept;
+    static void discard(message_ptr_t &message, const message_stringifier_t *stringifier, int threshold) noexcept;
+
+    /** \brief returns the inspection level of the message (`0` for non-rotor messages) */
+    static int get_level(const message_base_t &message) noexcept;
 };
 
 #if !defined(ROTOR_DO_DELIVERY_DEBUG)
@@ -67,6 +80,56 @@ struct ROTOR_API delivery_plugin_base_t : public plugin_base_t {
     void activate(actor_base_t *actor) noexcept override;
 
   protected:
+    /** \struct outbound_batch_t
+     *  \brief messages for the supervisor of other locality, accumulated during `process()`
+     */
+    struct outbound_batch_t {
+        /** \brief non-owning raw pointer to the destination supervisor */
+        supervisor_t *supervisor;
+
+        /** \brief messages to be enqueued to the destination supervisor */
+        messages_queue_t messages;
+    };
+
+    /** \brief list of per-destination outbound batches */
+    using outbound_batches_t = std::vector<outbound_batch_t>;
+
+    /** \brief postpones message for other locality until the end of `process()` */
+    void enqueue_outbound(message_ptr_t message) noexcept;
+
+    /** \brief hands each destination supervisor its batch of accumulated messages */
+    void flush_outbound() noexcept;
+
+    /** \struct untraced_t
+     *  \brief no-op recorder of the messages delivery events */
+    struct untraced_t {
+        /** \brief does nothing */
+        inline void operator()(const message_base_t &, trace_event_t) const noexcept {}
+    };
+
+    /** \struct traced_t
+     *  \brief records the messages delivery events into the sink */
+    struct traced_t {
+        /** \brief the events receiver */
+        trace_sink_t &sink;
+
+        /** \brief the supervisor, which processes the messages */
+        const supervisor_t &supervisor;
+
+        /** \brief the supervisor, which messages are recorded (`nullptr` for all messages) */
+        const supervisor_t *filter;
+
+        /** \brief the processed messages queue */
+        const messages_queue_t &queue;
+
+        /** \brief records the event, if the message passes the filter */
+        inline void operator()(const message_base_t &message, trace_event_t event) const noexcept {
+            if (!filter || &message.address->supervisor == filter) {
+                sink.record(supervisor, message, event, queue.size());
+            }
+        }
+    };
+
     /** \brief non-owning raw pointer of supervisor's messages queue */
     messages_queue_t *queue = nullptr;
 
@@ -78,6 +141,27 @@ struct ROTOR_API delivery_plugin_base_t : public plugin_base_t {
 
     /** \brief non-owning raw pointer to system's stringifier */
     const message_stringifier_t *stringifier;
+
+    /** \brief non-owning raw pointer to locality messages pool (might be `nullptr`) */
+    message_pool_t *pool = nullptr;
+
+    /** \brief max level of the dumped messages (negative if inspection is disabled)
+     *
+     * It is read once from `ROTOR_INSPECT_DELIVERY` environment variable upon activation.
+     */
+    int inspection_threshold = -1;
+
+    /** \brief non-owning raw pointer to supervisor's trace sink holder, see `supervisor_t::trace()` */
+    const std::atomic<trace_sink_t *> *trace_sink = nullptr;
+
+    /** \brief non-owning raw pointer to supervisor's trace filter holder, see `supervisor_t::trace()` */
+    const std::atomic<const supervisor_t *> *trace_filter = nullptr;
+
+    /** \brief non-owning raw pointer to supervisor's delivery statistics */
+    delivery_stats_t *stats = nullptr;
+
+    /** \brief outbound messages for other localities */
+    outbound_batches_t outbound;
 };
 
 /** \brief templated message delivery plugin, to allow local message delivery be customized */
@@ -90,6 +174,26 @@ template <typename LocalDelivery = local_delivery_t> struct delivery_plugin_t :
     const std::type_index &identity() const noexcept override { return class_identity; }
 
     inline size_t process() noexcept override;
+
+  private:
+    /* the message dump is performed for every delivered message, i.e. the cached handler is not used */
+    static constexpr bool inspected = std::is_same_v<LocalDelivery, inspected_local_delivery_t>;
+
+    template <typename Tracer> size_t process_messages(const Tracer &trace) noexcept;
+
+    inline void deliver(message_ptr_t &message, const subscription_t::joint_handlers_t &recipients) noexcept {
+        if constexpr (inspected) {
+            LocalDelivery::delivery(message, recipients, stringifier, inspection_threshold);
+        } else {
+            LocalDelivery::delivery(message, recipients);
+        }
+    }
+
+    inline void discard(message_ptr_t &message) noexcept {
+        if constexpr (inspected) {
+            LocalDelivery::discard(message, stringifier, inspection_threshold);
+        }
+    }
 };
 
 template <typename LocalDelivery>
@@ -7,6 +7,7 @@
 //
 
 #include "plugin_base.h"
+#include <unordered_set>
 
 namespace rotor::plugin {
 
@@ -61,6 +62,13 @@ struct ROTOR_API lifetime_plugin_t : public plugin_base_t {
      */
     virtual void on_unsubscription_external(message::unsubscription_external_t &) noexcept;
 
+    /** \brief returns `true` if the handler is (still) subscribed to the address
+     *
+     * The lookup is performed in constant time, i.e. it is suitable for
+     * checking each message, delivered to the actor from other supervisors.
+     */
+    bool is_subscribed(const handler_base_t &handler, const address_t &address) const noexcept;
+
     bool handle_unsubscription(const subscription_point_t &point, bool external) noexcept override;
 
     bool handle_shutdown(message::shutdown_request_t *message) noexcept override;
@@ -69,11 +77,34 @@ struct ROTOR_API lifetime_plugin_t : public plugin_base_t {
     template <typename T> auto &access() noexcept;
 
   private:
+    struct point_key_t {
+        const void *handler_type;
+        const address_t *address;
+        std::size_t hash;
+
+        inline bool operator==(const point_key_t &other) const noexcept {
+            return handler_type == other.handler_type && address == other.address;
+        }
+    };
+
+    struct point_hash_t {
+        inline std::size_t operator()(const point_key_t &key) const noexcept { return key.hash; }
+    };
+
+    using points_index_t = std::unordered_multiset<point_key_t, point_hash_t>;
+
+    static point_key_t make_key(const handler_base_t &handler, const address_t &address) noexcept;
+
     void unsubscribe() noexcept;
 
+    subscription_container_t::iterator erase(subscription_container_t::iterator it) noexcept;
+
     /** \brief recorded subscription points (i.e. handler/address pairs) */
     subscription_container_t points;
 
+    /** \brief hash index of the recorded subscription points */
+    points_index_t points_index;
+
     bool ready_to_shutdown() noexcept;
 };
 
@@ -139,6 +139,11 @@ struct wrapped_request_t<T, std::enable_if_t<std::is_base_of_v<arc_base_t<T>, T>
     request_t request_payload;
 };
 
+/** \brief shares the messages, referenced from the user-supplied request payload */
+template <typename T> inline void share_nested(const wrapped_request_t<T> &payload) noexcept {
+    share_nested(payload.request_payload);
+}
+
 /** \struct response_helper_t
  * \brief generic helper, which helps to construct user-defined response payload
  */
@@ -292,10 +297,39 @@ template <typename Request> struct wrapped_response_t {
     inline request_id_t request_id() const noexcept { return req->payload.id; }
 };
 
+/** \brief shares the original request message, the requests of the error chain and the messages,
+ * referenced from the user-supplied response payload */
+template <typename T> inline void share_nested(const wrapped_response_t<T> &payload) noexcept {
+    if (payload.req) {
+        payload.req->share();
+    }
+    share_requests(payload.ee);
+    share_nested(payload.res);
+}
+
 /** \brief free function type, which produces error response to the original request */
 typedef message_ptr_t(error_producer_t)(const address_ptr_t &reply_to, message_base_t &msg,
                                         const extended_error_ptr_t &ec) noexcept;
 
+struct request_slot_t;
+
+/** \struct request_continuation_t
+ * \brief suspended consumer of the request result (i.e. coroutine)
+ *
+ * The continuation is resumed directly by the supervisor, when the response
+ * or the timeout error arrives, i.e. the response is not delivered to the
+ * actor subscriptions.
+ */
+struct request_continuation_t {
+    virtual ~request_continuation_t() = default;
+
+    /** \brief resumes the consumer with the response (possibly error) message */
+    virtual void resume(message_ptr_t response) noexcept = 0;
+
+    /** \brief abandons the consumer, when the request is cancelled and no response will be delivered */
+    virtual void abandon() noexcept = 0;
+};
+
 /** \struct request_curry_t
  * \brief the recorded context, which is needed to produce error response to the original request */
 struct request_curry_t {
@@ -310,6 +344,12 @@ struct request_curry_t {
 
     /** \brief actor, on which behalf the original request has been made */
     actor_base_t *source;
+
+    /** \brief the rounded deadline of the request, when timeouts are coarse */
+    std::int64_t timeout_bucket;
+
+    /** \brief the consumer of the response instead of the actor subscriptions (if any) */
+    request_continuation_t *continuation = nullptr;
 };
 
 /** \struct request_traits_t
@@ -386,7 +426,11 @@ template <typename R> struct request_traits_t {
  */
 template <typename T> struct [[nodiscard]] request_builder_t {
 
-    /** \brief constructs request message but still does not dispatch it */
+    /** \brief constructs request message but still does not dispatch it
+     *
+     * The request slot (and the request id) is acquired only upon sending, i.e. the
+     * builder might be safely dropped without sending.
+     */
     template <typename... Args>
     request_builder_t(supervisor_t &sup_, actor_base_t &actor_, const address_ptr_t &destination_,
                       const address_ptr_t &reply_to_, Args &&...args);
@@ -398,6 +442,14 @@ template <typename T> struct [[nodiscard]] request_builder_t {
      */
     request_id_t send(const pt::time_duration &send) noexcept;
 
+    /** \brief dispatches requests and spawns timeout timer; the response (or timeout error)
+     * will be passed to the continuation instead of the actor
+     *
+     * The continuation must be alive until it is resumed or abandoned.
+     *
+     */
+    request_id_t send(const pt::time_duration &send, request_continuation_t &continuation) noexcept;
+
   private:
     using traits_t = request_traits_t<T>;
     using request_message_t = typename traits_t::request::message_t;
@@ -408,13 +460,13 @@ template <typename T> struct [[nodiscard]] request_builder_t {
 
     supervisor_t &sup;
     actor_base_t &actor;
-    request_id_t request_id;
     const address_ptr_t &destination;
     const address_ptr_t &reply_to;
     bool do_install_handler;
     request_message_ptr_t req;
     address_ptr_t imaginary_address;
 
+    request_id_t dispatch(const pt::time_duration &timeout, request_continuation_t *continuation) noexcept;
     void install_handler() noexcept;
 };
 
@@ -0,0 +1,197 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "request.hpp"
+#include "timer_handler.hpp"
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rotor {
+
+/** \struct request_timer_t
+ *  \brief timeout timer handler of a request, embedded into the request slot
+ *
+ * The timer owner is the supervisor, which made the request, and the timer
+ * id is the request id.
+ */
+struct ROTOR_API request_timer_t : timer_handler_base_t {
+    /** \brief constructs unbound timer handler */
+    request_timer_t() noexcept : timer_handler_base_t{nullptr, 0} {}
+
+    /** \brief forwards timer trigger to the supervisor, which made the request */
+    void trigger(bool cancelled) noexcept override;
+};
+
+struct request_slot_t;
+
+/** \struct request_link_t
+ *  \brief the links of the request slot within an intrusive list */
+struct request_link_t {
+    /** \brief previous slot in the list */
+    request_slot_t *prev = nullptr;
+
+    /** \brief next slot in the list */
+    request_slot_t *next = nullptr;
+};
+
+/** \struct request_slot_t
+ *  \brief the pending request record
+ *
+ * It holds the context for error response, the timeout timer handler and
+ * the links to the sibling active requests of the same actor and of the
+ * same coarse timeout bucket.
+ */
+struct request_slot_t {
+    /** \brief the context to produce error response */
+    request_curry_t curry{};
+
+    /** \brief timeout timer handler; its request id is the id of the pending request */
+    request_timer_t timer;
+
+    /** \brief active requests of the same actor (or next free slot) */
+    request_link_t actor_link;
+
+    /** \brief requests with the same coarse deadline */
+    request_link_t bucket_link;
+};
+
+/** \struct request_list_base_t
+ *  \brief intrusive list of request slots, threaded through the specified links */
+template <request_link_t request_slot_t::*Link> struct request_list_base_t {
+    /** \brief returns `true` if there are no slots in the list */
+    inline bool empty() const noexcept { return !head; }
+
+    /** \brief returns the id of the first request (the list must not be empty) */
+    inline request_id_t front() const noexcept { return head->timer.request_id; }
+
+    /** \brief returns the first slot (the list must not be empty) */
+    inline request_slot_t &first() const noexcept { return *head; }
+
+    /** \brief links the request slot into the list */
+    inline void push(request_slot_t &slot) noexcept {
+        auto &link = slot.*Link;
+        link.prev = nullptr;
+        link.next = head;
+        if (head) {
+            (head->*Link).prev = &slot;
+        }
+        head = &slot;
+    }
+
+    /** \brief unlinks the request slot from the list */
+    inline void remove(request_slot_t &slot) noexcept {
+        auto &link = slot.*Link;
+        if (link.prev) {
+            (link.prev->*Link).next = link.next;
+        } else {
+            assert(head == &slot);
+            head = link.next;
+        }
+        if (link.next) {
+            (link.next->*Link).prev = link.prev;
+        }
+        link.prev = link.next = nullptr;
+    }
+
+  private:
+    request_slot_t *head = nullptr;
+};
+
+/** \brief intrusive list of active (pending) requests of an actor */
+using request_list_t = request_list_base_t<&request_slot_t::actor_link>;
+
+/** \brief intrusive list of requests of a coarse timeout bucket */
+using request_bucket_list_t = request_list_base_t<&request_slot_t::bucket_link>;
+
+/** \struct request_slots_t
+ *  \brief generation-tagged slab of pending requests of the locality
+ *
+ * The request id encodes the slot index in the lower half of the id bits and the
+ * slot generation in the upper half; the highest bit is always set, which makes
+ * request ids distinct from the other timer ids. The generation is bumped each
+ * time the slot is released, so a stale id (e.g. of a late response) never
+ * matches the request, which currently occupies the same slot.
+ *
+ * The slots are allocated in chunks and never move, i.e. the embedded timer handlers
+ * can be referenced by timer backends. Released slots are reused, so there are no
+ * allocations per request once the slab is warmed up.
+ *
+ * The slab is owned by locality leader and is shared by all supervisors of the locality.
+ *
+ * The amount of simultaneously pending requests is limited by the index bits, i.e. it
+ * is `65536` when `request_id_t` is 32-bit; the exhaustion of the slab is fatal.
+ */
+struct ROTOR_API request_slots_t {
+    /** \brief number of bits of slot index within chunk */
+    static constexpr unsigned chunk_bits = 6;
+
+    /** \brief amount of slots in a chunk */
+    static constexpr std::size_t chunk_size = std::size_t{1} << chunk_bits;
+
+    /** \brief number of bits, encoding slot index in request id */
+    static constexpr unsigned index_bits = sizeof(request_id_t) * 4;
+
+    /** \brief the bit, which is set in all request ids */
+    static constexpr request_id_t request_bit = request_id_t{1} << (sizeof(request_id_t) * 8 - 1);
+
+    request_slots_t() noexcept;
+    request_slots_t(const request_slots_t &) = delete;
+    request_slots_t(request_slots_t &&) = delete;
+
+    /** \brief returns `true` if the id is a request id (and not a regular timer id) */
+    static inline bool is_request(request_id_t id) noexcept { return id & request_bit; }
+
+    /** \brief occupies a free slot; its request id is available via `slot.timer.request_id` */
+    request_slot_t &acquire() noexcept;
+
+    /** \brief resets and frees previously occupied slot */
+    void release(request_slot_t &slot) noexcept;
+
+    /** \brief returns the slot, occupied by the request, or `nullptr` if the request is not pending */
+    inline request_slot_t *find(request_id_t id) noexcept {
+        auto index = static_cast<std::size_t>(id & index_mask);
+        if (!is_request(id) || index >= capacity) {
+            return nullptr;
+        }
+        auto &slot = chunks[index >> chunk_bits][index & (chunk_size - 1)];
+        return slot.timer.request_id == id ? &slot : nullptr;
+    }
+
+    /** \brief returns amount of pending requests */
+    inline std::size_t size() const noexcept { return occupied; }
+
+    /** \brief returns `true` if there are no pending requests */
+    inline bool empty() const noexcept { return !occupied; }
+
+  private:
+    static constexpr request_id_t index_mask = (request_id_t{1} << index_bits) - 1;
+    static constexpr request_id_t generation_mask = ~(index_mask | request_bit);
+
+    using chunk_t = std::unique_ptr<request_slot_t[]>;
+    using chunks_t = std::vector<chunk_t>;
+
+    void grow() noexcept;
+
+    chunks_t chunks;
+    request_slot_t *free_slots;
+    std::size_t capacity;
+    std::size_t occupied;
+};
+
+} // namespace rotor
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
@@ -11,6 +11,7 @@
 #include "rotor/subscription_point.h"
 #include "rotor/message.h"
 #include <boost/unordered_map.hpp>
+#include <memory>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -31,8 +32,55 @@ struct ROTOR_API subscription_t {
     /** \brief alias for message type (i.e. stringized typeid) */
     using message_type_t = const void *;
 
-    /** \brief vector of handler pointers */
-    using handlers_t = std::vector<handler_base_t *>;
+    /** \struct handlers_t
+     *  \brief list of handler pointers, the single handler is stored inline
+     */
+    struct ROTOR_API handlers_t {
+        /** \brief alias for handler pointer iterator */
+        using iterator = handler_base_t **;
+
+        /** \brief alias for handler pointer const iterator */
+        using const_iterator = handler_base_t *const *;
+
+        handlers_t() noexcept : count{0}, capacity{1}, local{nullptr} {}
+        handlers_t(handlers_t &&other) noexcept;
+        handlers_t &operator=(handlers_t &&other) noexcept;
+
+        /** \brief returns iterator to the first handler */
+        inline iterator begin() noexcept { return data(); }
+
+        /** \brief returns past-the-end iterator */
+        inline iterator end() noexcept { return data() + count; }
+
+        /** \brief returns const iterator to the first handler */
+        inline const_iterator begin() const noexcept { return data(); }
+
+        /** \brief returns past-the-end const iterator */
+        inline const_iterator end() const noexcept { return data() + count; }
+
+        /** \brief returns amount of handlers */
+        inline std::size_t size() const noexcept { return count; }
+
+        /** \brief returns `true` if there are no handlers */
+        inline bool empty() const noexcept { return !count; }
+
+        /** \brief appends the handler to the end of the list */
+        void emplace_back(handler_base_t *handler) noexcept;
+
+        /** \brief removes the handler at the position, the order of the remaining handlers is kept */
+        void erase(iterator it) noexcept;
+
+      private:
+        using heap_t = std::unique_ptr<handler_base_t *[]>;
+
+        inline handler_base_t **data() noexcept { return capacity == 1 ? &local : heap.get(); }
+        inline handler_base_t *const *data() const noexcept { return capacity == 1 ? &local : heap.get(); }
+
+        std::size_t count;
+        std::size_t capacity;
+        handler_base_t *local;
+        heap_t heap;
+    };
 
     /** \struct joint_handlers_t
      *  \brief pair internal and external {@link handler_t}
@@ -62,12 +110,17 @@ struct ROTOR_API subscription_t {
     void forget(const subscription_info_ptr_t &info) noexcept;
 
     /** \brief returns list of all handlers for the message (internal and external) */
-    const joint_handlers_t *get_recipients(const message_base_t &message) const noexcept;
+    inline const joint_handlers_t *get_recipients(const message_base_t &message) const noexcept {
+        return mine_handlers.find({message.address.get(), message.type_index});
+    }
 
     /** \brief generic non-public fields accessor */
     template <typename T> auto &access() noexcept;
 
   private:
+    static void update_cache(address_t &address, message_type_t message_type,
+                             const joint_handlers_t *handlers) noexcept;
+
     struct subscription_key_t {
         address_t *address;
         message_type_t message_type;
@@ -76,13 +129,55 @@ struct ROTOR_API subscription_t {
         }
     };
 
-    struct subscription_key_hash_t {
-        inline std::size_t operator()(const subscription_key_t &k) const noexcept {
-            return std::size_t(k.address) + 0x9e3779b9 + (size_t(k.message_type) << 6) + (size_t(k.message_type) >> 2);
+    /* flat open-addressing (linear probing) hash table; the key hash is derived from the
+     * precomputed address hash, the removal is done via backward shift, i.e. without tombstones */
+    struct ROTOR_API addressed_handlers_t {
+        addressed_handlers_t() noexcept;
+
+        inline const joint_handlers_t *find(const subscription_key_t &key) const noexcept {
+            if (!occupied) {
+                return nullptr;
+            }
+            auto hash = hash_of(key);
+            for (auto index = hash & mask;; index = (index + 1) & mask) {
+                auto &slot = slots[index];
+                if (slot.key == key) {
+                    return &slot.handlers;
+                } else if (!slot.key.address) {
+                    return nullptr;
+                }
+            }
         }
-    };
 
-    using addressed_handlers_t = boost::unordered_map<subscription_key_t, joint_handlers_t, subscription_key_hash_t>;
+        inline joint_handlers_t *find(const subscription_key_t &key) noexcept {
+            auto self = const_cast<const addressed_handlers_t *>(this);
+            return const_cast<joint_handlers_t *>(self->find(key));
+        }
+
+        joint_handlers_t &try_emplace(const subscription_key_t &key) noexcept;
+        void erase(const subscription_key_t &key) noexcept;
+        inline std::size_t size() const noexcept { return occupied; }
+        inline bool empty() const noexcept { return !occupied; }
+
+      private:
+        struct slot_t {
+            subscription_key_t key;
+            std::size_t hash;
+            joint_handlers_t handlers;
+        };
+        using slots_t = std::vector<slot_t>;
+
+        static inline std::size_t hash_of(const subscription_key_t &key) noexcept {
+            auto value = key.address->hash + reinterpret_cast<std::size_t>(key.message_type);
+            return value ^ (value >> (sizeof(std::size_t) * 4));
+        }
+
+        void grow() noexcept;
+
+        slots_t slots;
+        std::size_t mask;
+        std::size_t occupied;
+    };
 
     using info_container_t = boost::unordered_map<address_ptr_t, std::vector<subscription_info_ptr_t>>;
     address_t *main_address;
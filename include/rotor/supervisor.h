@@ -9,13 +9,19 @@
 #include "actor_base.h"
 #include "handler.h"
 #include "message.h"
+#include "inbound_queue.h"
 #include "subscription.h"
 #include "system_context.h"
 #include "supervisor_config.h"
 #include "address_mapping.h"
 #include "error_code.h"
 #include "spawner.h"
+#include "trace_sink.h"
+#include "delivery_stats.h"
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -129,6 +135,35 @@ struct ROTOR_API supervisor_t : public actor_base_t {
      */
     inline size_t do_process() noexcept { return locality_leader->delivery->process(); }
 
+    /** \brief enables (or, with `nullptr`, disables) messages delivery tracing
+     *
+     * The messages are processed by the locality leader, so the sink is installed
+     * into it. When the method is invoked on the locality leader, all messages of the
+     * locality are traced, otherwise only the messages to the addresses of this
+     * supervisor are traced. There is a single sink per locality, i.e. the last
+     * invocation wins.
+     *
+     * The delivery plugin checks the sink once per `do_process()` invocation, i.e.
+     * the tracing might be toggled from any thread at runtime, and it costs a single
+     * atomic load per messages batch, while it is disabled.
+     *
+     * The sink must outlive the supervisor. The method should be invoked after the
+     * supervisor has been created (i.e. its locality is known).
+     */
+    inline void trace(trace_sink_t *sink) noexcept {
+        assert(locality_leader && "the supervisor is not initialized yet");
+        auto filter = locality_leader == this ? nullptr : this;
+        locality_leader->trace_filter.store(filter, std::memory_order_relaxed);
+        locality_leader->trace_sink.store(sink, std::memory_order_release);
+    }
+
+    /** \brief returns the current messages delivery statistics (can be invoked from any thread)
+     *
+     * The statistics are collected only if rotor is built with `ROTOR_DELIVERY_STATS`
+     * option, otherwise all counters are zero. Makes sense only for root/leader supervisor.
+     */
+    inline delivery_counters_t get_delivery_stats() const noexcept { return delivery_stats.snapshot(); }
+
     /** \brief creates new {@link address_t} linked with the supervisor */
     virtual address_ptr_t make_address() noexcept;
 
@@ -173,6 +208,17 @@ struct ROTOR_API supervisor_t : public actor_base_t {
      */
     virtual void enqueue(message_ptr_t message) noexcept = 0;
 
+    /** \brief enqueues all messages from the batch thread safe way and triggers processing
+     *
+     * The messages are taken from the batch, i.e. it is empty upon return.
+     *
+     * The default implementation just `enqueue`s messages one by one; it is
+     * expected that derived classes override it to put all the messages into
+     * the inbound queue and perform a single wakeup of the event loop.
+     *
+     */
+    virtual void enqueue_batch(messages_queue_t &messages) noexcept;
+
     /** \brief puts a message into internal supervisor queue for further processing
      *
      * This is thread-unsafe method. The `enqueue` method should be used to put
@@ -246,14 +292,27 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     template <typename T, typename... Args> auto access(Args... args) noexcept;
 
     /** \brief lock-free queue for inbound messages */
-    using inbound_queue_t = boost::lockfree::queue<message_base_t *>;
+    using inbound_queue_t = rotor::inbound_queue_t;
 
   protected:
     /** \brief creates new address with respect to supervisor locality mark */
     virtual address_ptr_t instantiate_address(const void *locality) noexcept;
 
-    /** \brief timer to response with timeout procedure type */
-    using request_map_t = std::unordered_map<request_id_t, request_curry_t>;
+    /** \struct timeout_bucket_t
+     *  \brief the requests with the same rounded deadline, guarded by the single timer */
+    struct timeout_bucket_t {
+        /** \brief the timer, shared by the requests */
+        request_id_t timer_id;
+
+        /** \brief whether the timer has been triggered, i.e. the requests are being expired */
+        bool expired = false;
+
+        /** \brief pending requests of the bucket */
+        request_bucket_list_t requests;
+    };
+
+    /** \brief rounded deadline to timeout bucket mapping type */
+    using timeout_buckets_t = std::map<std::int64_t, timeout_bucket_t>;
 
     /** \brief invoked as timer callback; creates response or just clean up for previously set request */
     void on_request_trigger(request_id_t timer_id, bool cancelled) noexcept;
@@ -261,8 +320,19 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     /** \brief starts non-recurring timer (to be implemented in descendants) */
     virtual void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept = 0;
 
-    /** \brief cancels timer (to be implemented in descendants) */
-    virtual void do_cancel_timer(request_id_t timer_id) noexcept = 0;
+    /** \brief cancels timer of the previously started handler (to be implemented in descendants) */
+    virtual void do_cancel_timer(timer_handler_base_t &handler) noexcept = 0;
+
+    /** \brief alias for monotonic clock of the supervisor */
+    using clock_t = std::chrono::steady_clock;
+
+    /** \brief returns current time of the supervisor clock
+     *
+     * It is used to round coarse request deadlines, so it should be the clock,
+     * the timers are started against. The default implementation just queries
+     * `std::chrono::steady_clock`.
+     */
+    virtual clock_t::time_point now() noexcept;
 
     /** \brief intercepts message delivery for the tagged handler */
     virtual void intercept(message_ptr_t &message, const void *tag, const continuation_t &continuation) noexcept;
@@ -276,8 +346,11 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     /** \brief counter for request/timer ids */
     request_id_t last_req_id;
 
-    /** \brief timer to response with timeout procedure */
-    request_map_t request_map;
+    /** \brief pending requests of the locality (used only by locality leader) */
+    request_slots_t request_slots;
+
+    /** \brief coarse request timeouts, ordered by rounded deadline */
+    timeout_buckets_t timeout_buckets;
 
     /** \brief main subscription support class  */
     subscription_t subscription_map;
@@ -288,6 +361,15 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     /** \brief delivery plugin pointer */
     plugin::delivery_plugin_base_t *delivery = nullptr;
 
+    /** \brief current messages delivery trace sink of the locality (`nullptr` if tracing is disabled) */
+    std::atomic<trace_sink_t *> trace_sink{nullptr};
+
+    /** \brief the supervisor, which messages are traced (`nullptr` for the whole locality) */
+    std::atomic<const supervisor_t *> trace_filter{nullptr};
+
+    /** \brief messages delivery counters (empty, unless `ROTOR_DELIVERY_STATS` is defined) */
+    delivery_stats_t delivery_stats;
+
     /** \brief child manager plugin pointer */
     plugin::child_manager_plugin_t *manager = nullptr;
 
@@ -303,6 +385,18 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     /** \brief how much time spend in active inbound queue polling */
     pt::time_duration poll_duration;
 
+    /** \brief whether locality messages should be allocated from the pool */
+    bool pool_messages;
+
+    /** \brief messages pool of the locality (shared with locality leader) */
+    message_pool_ptr_t message_pool;
+
+    /** \brief granularity of request timeouts (zero means one timer per request) */
+    pt::time_duration timeout_granularity;
+
+    /** \brief whether the addresses, made by the supervisor, are owned by the system context */
+    bool pin_addresses;
+
     /** \brief when flag is set, the supervisor will shut self down */
     const std::atomic_bool *shutdown_flag = nullptr;
 
@@ -326,22 +420,19 @@ struct ROTOR_API supervisor_t : public actor_base_t {
     template <typename Supervisor> friend struct actor_config_builder_t;
     friend struct plugin::delivery_plugin_base_t;
     friend struct actor_base_t;
+    friend struct request_timer_t;
     template <typename T> friend struct plugin::delivery_plugin_t;
 
     void discard_request(request_id_t request_id) noexcept;
+    std::int64_t start_coarse_timer(request_slot_t &slot, const pt::time_duration &timeout) noexcept;
+    void cancel_request_timer(request_id_t request_id) noexcept;
+    void on_coarse_timer(std::int64_t deadline, request_id_t timer_id, bool cancelled) noexcept;
     void uplift_last_message() noexcept;
 
     void on_shutdown_check_timer(request_id_t, bool cancelled) noexcept;
 
-    inline request_id_t next_request_id() noexcept {
-    AGAIN:
-        auto &map = locality_leader->request_map;
-        auto it = map.find(++locality_leader->last_req_id);
-        if (it != map.end()) {
-            goto AGAIN;
-        }
-        return locality_leader->last_req_id;
-    }
+    /* request ids are allocated by the request slots, i.e. they never clash with the timer ids */
+    inline request_id_t next_request_id() noexcept { return ++locality_leader->last_req_id; }
 };
 
 using supervisor_ptr_t = intrusive_ptr_t<supervisor_t>;
@@ -365,12 +456,16 @@ template <typename Supervisor> auto system_context_t::create_supervisor() {
 }
 
 template <typename M, typename... Args> void actor_base_t::send(const address_ptr_t &addr, Args &&...args) {
-    supervisor->put(make_message<M>(addr, std::forward<Args>(args)...));
+    auto pool = supervisor->message_pool.get();
+    supervisor->put(make_pooled_message<M>(pool, addr, std::forward<Args>(args)...));
 }
 
 template <typename M, typename... Args>
 void actor_base_t::route(const address_ptr_t &addr, const address_ptr_t &next_addr, Args &&...args) {
-    supervisor->put(make_routed_message<M>(addr, next_addr, std::forward<Args>(args)...));
+    auto pool = supervisor->message_pool.get();
+    auto message = make_pooled_message<M>(pool, addr, std::forward<Args>(args)...);
+    message->next_route = next_addr;
+    supervisor->put(std::move(message));
 }
 
 template <typename M> void redirect(M message, const address_ptr_t &addr, const address_ptr_t &next_addr) {}
@@ -442,58 +537,66 @@ subscription_info_ptr_t starter_plugin_t::subscribe_actor(Handler &&handler, con
     return info;
 }
 
-template <> inline size_t delivery_plugin_t<plugin::local_delivery_t>::process() noexcept {
-    size_t enqueued_messages{0};
-    while (queue->size()) {
-        auto ptr = queue->front().detach();
-        auto message = message_ptr_t(ptr, false);
-        auto &dest = message->address;
-        queue->pop_front();
-        auto internal = dest->same_locality(*address);
-        if (internal) { /* subscriptions are handled by me */
-            auto local_recipients = subscription_map->get_recipients(*message);
-            if (local_recipients) {
-                plugin::local_delivery_t::delivery(message, *local_recipients);
-            }
-            if (message->next_route && message->use_count() == 1) {
-                auto sup = static_cast<supervisor_t *>(actor);
-                message->address = std::move(message->next_route);
-                sup->put(std::move(message));
-            }
-        } else {
-            dest->supervisor.enqueue(std::move(message));
-            ++enqueued_messages;
-        }
+template <typename LocalDelivery> inline size_t delivery_plugin_t<LocalDelivery>::process() noexcept {
+    if (auto sink = trace_sink->load(std::memory_order_acquire); sink) {
+        auto filter = trace_filter->load(std::memory_order_relaxed);
+        auto &sup = *static_cast<supervisor_t *>(actor);
+        return process_messages(traced_t{*sink, sup, filter, *queue});
     }
-    return enqueued_messages;
+    return process_messages(untraced_t{});
 }
 
-template <> inline size_t delivery_plugin_t<plugin::inspected_local_delivery_t>::process() noexcept {
+template <typename LocalDelivery>
+template <typename Tracer>
+inline size_t delivery_plugin_t<LocalDelivery>::process_messages(const Tracer &trace) noexcept {
+    message_pool_t::guard_t guard(pool);
     size_t enqueued_messages{0};
+    size_t processed_messages{0};
     while (queue->size()) {
-        auto ptr = queue->front().detach();
-        auto message = message_ptr_t(ptr, false);
+        stats->on_queue_depth(queue->size());
+        ++processed_messages;
+        auto message = queue->take_front();
         auto &dest = message->address;
-        queue->pop_front();
         auto internal = dest->same_locality(*address);
-        const subscription_t::joint_handlers_t *local_recipients = nullptr;
         if (internal) { /* subscriptions are handled by me */
-            local_recipients = subscription_map->get_recipients(*message);
-            if (local_recipients) {
-                plugin::inspected_local_delivery_t::delivery(message, *local_recipients, stringifier);
+            bool delivered = false;
+            if (!inspected && dest->cached_type == message->type_index) {
+                trace(*message, trace_event_t::delivered);
+                stats->on_dispatched();
+                [[maybe_unused]] auto timer = stats->measure_handlers();
+                dest->cached_handler->dispatch(message);
+                delivered = true;
+            } else {
+                auto local_recipients = subscription_map->get_recipients(*message);
+                if (local_recipients) {
+                    trace(*message, trace_event_t::delivered);
+                    stats->on_dispatched();
+                    [[maybe_unused]] auto timer = stats->measure_handlers();
+                    deliver(message, *local_recipients);
+                    delivered = true;
+                } else {
+                    stats->on_discarded();
+                }
             }
-            if (ptr->next_route && ptr->use_count() == 1) {
+            if (message->next_route && message->use_count() == 1) {
                 auto sup = static_cast<supervisor_t *>(actor);
                 message->address = std::move(message->next_route);
                 sup->put(std::move(message));
-            } else if (!local_recipients) {
-                plugin::inspected_local_delivery_t::discard(message, stringifier);
+            } else if (!delivered) {
+                trace(*message, trace_event_t::discarded);
+                discard(message);
             }
         } else {
-            dest->supervisor.enqueue(std::move(message));
+            trace(*message, trace_event_t::forwarded);
+            stats->on_forwarded();
+            enqueue_outbound(std::move(message));
             ++enqueued_messages;
         }
     }
+    stats->on_batch(processed_messages);
+    if (enqueued_messages) {
+        flush_outbound();
+    }
     return enqueued_messages;
 }
 
@@ -512,8 +615,7 @@ template <typename T>
 template <typename... Args>
 request_builder_t<T>::request_builder_t(supervisor_t &sup_, actor_base_t &actor_, const address_ptr_t &destination_,
                                         const address_ptr_t &reply_to_, Args &&...args)
-    : sup{sup_}, actor{actor_}, request_id{sup.next_request_id()}, destination{destination_}, reply_to{reply_to_},
-      do_install_handler{false} {
+    : sup{sup_}, actor{actor_}, destination{destination_}, reply_to{reply_to_}, do_install_handler{false} {
     auto addr = sup.address_mapping.get_mapped_address(actor_, response_message_t::message_type);
     if (addr) {
         imaginary_address = addr;
@@ -524,39 +626,72 @@ request_builder_t<T>::request_builder_t(supervisor_t &sup_, actor_base_t &actor_
         imaginary_address = sup.make_address();
         do_install_handler = true;
     }
-    req.reset(
-        new request_message_t{destination, request_id, imaginary_address, reply_to_, std::forward<Args>(args)...});
+    // the request id is assigned upon sending, i.e. when the request slot is acquired
+    auto pool = sup.message_pool.get();
+    req.reset(message_support::construct<request_message_t>(pool, destination, request_id_t{0}, imaginary_address,
+                                                            reply_to_, std::forward<Args>(args)...));
 }
 
 template <typename T> request_id_t request_builder_t<T>::send(const pt::time_duration &timeout_) noexcept {
+    return dispatch(timeout_, nullptr);
+}
+
+template <typename T>
+request_id_t request_builder_t<T>::send(const pt::time_duration &timeout_,
+                                        request_continuation_t &continuation) noexcept {
+    return dispatch(timeout_, &continuation);
+}
+
+template <typename T>
+request_id_t request_builder_t<T>::dispatch(const pt::time_duration &timeout_,
+                                            request_continuation_t *continuation) noexcept {
     if (do_install_handler) {
         install_handler();
     }
+    auto &slot = sup.locality_leader->request_slots.acquire();
+    auto request_id = slot.timer.request_id;
+    req->payload.id = request_id;
     auto fn = &request_traits_t<T>::make_error_response;
-    sup.request_map.emplace(request_id, request_curry_t{fn, reply_to, req, &actor});
+    slot.curry = request_curry_t{fn, reply_to, req, &actor, 0, continuation};
     sup.put(req);
-    sup.start_timer(request_id, timeout_, sup, &supervisor_t::on_request_trigger);
-    actor.active_requests.emplace(request_id);
+    if (sup.timeout_granularity.is_zero()) {
+        slot.timer.owner = &sup;
+        sup.do_start_timer(timeout_, slot.timer);
+    } else {
+        slot.curry.timeout_bucket = sup.start_coarse_timer(slot, timeout_);
+    }
+    actor.active_requests.push(slot);
     return request_id;
 }
 
 template <typename T> void request_builder_t<T>::install_handler() noexcept {
     auto handler = lambda<response_message_t>([supervisor = &sup](response_message_t &msg) {
         auto request_id = msg.payload.request_id();
-        auto &request_map = supervisor->request_map;
-        auto it = request_map.find(request_id);
+        auto slot = supervisor->locality_leader->request_slots.find(request_id);
 
-        // if a response to request has arrived and no timer can be found
+        // if a response to request has arrived and no pending request can be found
         // that means that either timeout timer already triggered
         // and error-message already delivered or response is not expected.
         // just silently drop it anyway
-        if (it != request_map.end()) {
-            auto &curry = it->second;
-            auto &orig_addr = curry.origin;
-            supervisor->template send<wrapped_res_t>(orig_addr, msg.payload);
-            supervisor->discard_request(request_id);
-            // keep order, i.e. deliver response immediately
-            supervisor->uplift_last_message();
+        if (slot) {
+            auto &orig_addr = slot->curry.origin;
+            if (auto continuation = slot->curry.continuation) {
+                // the awaiting consumer is resumed directly, without message redelivery
+                slot->curry.continuation = nullptr;
+                supervisor->discard_request(request_id);
+                continuation->resume(message_ptr_t(&msg));
+            } else if (msg.use_count() == 1 && orig_addr->same_locality(*msg.address)) {
+                // nobody else holds the response, so it is retargeted in place
+                // and delivered immediately (i.e. the order is kept)
+                msg.address = orig_addr;
+                supervisor->discard_request(request_id);
+                supervisor->locality_leader->queue.push_front(message_ptr_t(&msg));
+            } else {
+                supervisor->template send<wrapped_res_t>(orig_addr, msg.payload);
+                supervisor->discard_request(request_id);
+                // keep order, i.e. deliver response immediately
+                supervisor->uplift_last_message();
+            }
         }
     });
     auto wrapped_handler = wrap_handler(sup, std::move(handler));
@@ -601,7 +736,9 @@ template <typename Request, typename... Args> auto actor_base_t::make_response(R
     using req_traits_t = request_traits_t<payload_t>;
     using response_t = typename req_traits_t::response::wrapped_t;
     using request_ptr_t = typename req_traits_t::request::message_ptr_t;
-    return make_message<response_t>(message.payload.reply_to, request_ptr_t{&message}, std::forward<Args>(args)...);
+    auto pool = supervisor->message_pool.get();
+    return make_pooled_message<response_t>(pool, message.payload.reply_to, request_ptr_t{&message},
+                                           std::forward<Args>(args)...);
 }
 
 template <typename Request, typename... Args> void actor_base_t::reply_to(Request &message, Args &&...args) {
@@ -45,6 +45,14 @@ struct supervisor_config_t : actor_config_t {
      *  root/leader supervisor */
     size_t inbound_queue_size = 64;
 
+    /** \brief whether the intrusive inbound queue should be used instead of
+     * `boost::lockfree::queue`. Makes sense only for root/leader supervisor
+     *
+     * The intrusive queue lets the consumer to take all the pending inbound
+     * messages with a single atomic exchange, see `inbound_queue_t`.
+     */
+    bool intrusive_inbound_queue = false;
+
     /**
      * \brief How much time it will spend in polling inbound queue before switching into
      * sleep mode (i.e. waiting external messages).
@@ -56,6 +64,36 @@ struct supervisor_config_t : actor_config_t {
      */
     pt::time_duration poll_duration = pt::millisec{1};
 
+    /** \brief whether messages of the locality should be allocated from the pool.
+     *  Makes sense only for root/leader supervisor
+     *
+     * The pooled messages sent by actors are recycled upon release instead of
+     * being freed back to the heap.
+     */
+    bool pool_messages = false;
+
+    /** \brief granularity of request timeouts (zero means one timer per request)
+     *
+     * When it is set, the deadlines of the requests, made by the supervisor and
+     * its actors, are rounded up to the granularity, and all the requests with
+     * the same rounded deadline share a single timer. The request timeout might
+     * happen up to the granularity later than requested, but never earlier.
+     */
+    pt::time_duration timeout_granularity = pt::time_duration{};
+
+    /** \brief whether the addresses, made by the supervisor, should be pinned
+     *
+     * Pinned addresses are owned by the system context, so copying and releasing
+     * their intrusive pointers does not touch the (atomic) reference counter. The
+     * memory of a pinned address is reclaimed only when the system context is
+     * destroyed, i.e. it should be enabled for supervisors with a bounded set of
+     * addresses, and the system context must outlive all the actors and messages,
+     * which refer the addresses. The memory is never re-used for other addresses,
+     * still the pinned addresses should not be kept after the removal of the
+     * supervisor, which made them, as messages sent to them are dropped.
+     */
+    bool pin_addresses = false;
+
     /** \brief pointer to atomic shutdown flag for polling (optional)
      *
      *  When it is set, supervisor will periodically check that the flag
@@ -109,12 +147,37 @@ template <typename Supervisor> struct supervisor_config_builder_t : actor_config
         return std::move(*static_cast<builder_t *>(this));
     }
 
+    /** \brief instructs to use intrusive inbound queue. Makes sense only for root/leader supervisor */
+    builder_t &&intrusive_inbound_queue(bool value = true) && {
+        parent_t::config.intrusive_inbound_queue = value;
+        return std::move(*static_cast<builder_t *>(this));
+    }
+
     /** \brief how much time spend in active inbound queue polling */
     builder_t &&poll_duration(const pt::time_duration &value) && {
         parent_t::config.poll_duration = value;
         return std::move(*static_cast<builder_t *>(this));
     }
 
+    /** \brief instructs to allocate locality messages from the pool. Makes sense
+     * only for root/leader supervisor */
+    builder_t &&pool_messages(bool value = true) && {
+        parent_t::config.pool_messages = value;
+        return std::move(*static_cast<builder_t *>(this));
+    }
+
+    /** \brief instructs to coalesce request timeout timers with the specified granularity */
+    builder_t &&timeout_granularity(const pt::time_duration &value) && {
+        parent_t::config.timeout_granularity = value;
+        return std::move(*static_cast<builder_t *>(this));
+    }
+
+    /** \brief instructs to make addresses owned by the system context, see `supervisor_config_t::pin_addresses` */
+    builder_t &&pin_addresses(bool value = true) && {
+        parent_t::config.pin_addresses = value;
+        return std::move(*static_cast<builder_t *>(this));
+    }
+
     /** \brief atomic shutdown flag and the period for polling it
      *
      * The thread-safe way to shutdown supervisor even when compiled with
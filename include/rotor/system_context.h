@@ -10,8 +10,12 @@
 #include "supervisor_config.h"
 #include "extended_error.h"
 #include "message_stringifier.h"
+#include "delivery_stats.h"
 
+#include <memory>
+#include <mutex>
 #include <system_error>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -59,6 +63,12 @@ struct ROTOR_API system_context_t : arc_base_t<system_context_t> {
      */
     virtual std::string identity() noexcept;
 
+    /** \brief returns the messages delivery statistics of the root supervisor (can be invoked from any thread)
+     *
+     * The counters are zero, unless rotor is built with `ROTOR_DELIVERY_STATS` option.
+     */
+    delivery_counters_t get_delivery_stats() const noexcept;
+
     /** \brief generic non-public fields accessor */
     template <typename T> auto &access() noexcept;
 
@@ -74,7 +84,15 @@ struct ROTOR_API system_context_t : arc_base_t<system_context_t> {
     virtual message_stringifier_ptr_t make_stringifier() const noexcept;
 
   private:
+    using pinned_address_t = std::unique_ptr<address_t>;
+    using pinned_addresses_t = std::vector<pinned_address_t>;
+
     friend struct supervisor_t;
+
+    /* declared before the root supervisor, i.e. pinned addresses outlive it */
+    std::mutex pinned_mutex;
+    pinned_addresses_t pinned_addresses;
+
     supervisor_ptr_t supervisor;
     message_stringifier_ptr_t stringifier;
 };
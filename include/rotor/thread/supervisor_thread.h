@@ -28,13 +28,17 @@ struct ROTOR_THREAD_API supervisor_thread_t : public supervisor_t {
     void start() noexcept override;
     void shutdown() noexcept override;
     void enqueue(message_ptr_t message) noexcept override;
+    void enqueue_batch(messages_queue_t &messages) noexcept override;
     void intercept(message_ptr_t &message, const void *tag, const continuation_t &continuation) noexcept override;
 
     /** \brief updates timer and fires timer handlers, which have been expired */
     void update_time() noexcept;
 
     void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    void do_cancel_timer(request_id_t timer_id) noexcept override;
+    void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
+
+    /** \brief returns the time of the last timers update of the thread context */
+    clock_t::time_point now() noexcept override;
 };
 
 } // namespace thread
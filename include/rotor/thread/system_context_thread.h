@@ -10,9 +10,10 @@
 #include "rotor/system_context.h"
 #include "rotor/timer_handler.hpp"
 #include "rotor/thread/export.h"
+#include "rotor/timer_wheel.h"
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
-#include <list>
 #include <mutex>
 #include <thread>
 
@@ -49,21 +50,7 @@ struct ROTOR_THREAD_API system_context_thread_t : public system_context_t {
 
   protected:
     /** \brief an alias for monotonic clock */
-    using clock_t = std::chrono::steady_clock;
-
-    /** \struct deadline_info_t
-     *  \brief struct to keep timer handlers
-     */
-    struct deadline_info_t {
-        /** \brief non-owning pointer to timer handler  */
-        timer_handler_base_t *handler;
-
-        /** \brief time point, after which the timer is considered expired */
-        clock_t::time_point deadline;
-    };
-
-    /** \brief ordered list of deadline infos (type) */
-    using list_t = std::list<deadline_info_t>;
+    using clock_t = timer_wheel_t::clock_t;
 
     /** \brief fires handlers for expired timers */
     void update_time() noexcept;
@@ -73,7 +60,7 @@ struct ROTOR_THREAD_API system_context_thread_t : public system_context_t {
 
     /** \brief cancel timer implementation */
 
-    void cancel_timer(request_id_t timer_id) noexcept;
+    void cancel_timer(timer_handler_base_t &handler) noexcept;
 
     /** \brief mutex for inbound queue */
     std::mutex mutex;
@@ -81,11 +68,22 @@ struct ROTOR_THREAD_API system_context_thread_t : public system_context_t {
     /** \brief cv for notifying about pushing messages into inbound queue */
     std::condition_variable cv;
 
+    /** \brief whether the context thread is parked on `cv` (or about to be parked)
+     *
+     * Producers lock the mutex and notify the `cv` only if the flag is set,
+     * i.e. there is no locking while the context thread is busy with processing
+     * or with polling the inbound queue.
+     */
+    std::atomic_bool sleeping{false};
+
+    /** \brief wakes up the context thread if it is parked (to be invoked after a push into inbound queue) */
+    void wake_up() noexcept;
+
     /** \brief current time */
     clock_t::time_point now;
 
-    /** \brief ordered list of deadline infos */
-    list_t timer_nodes;
+    /** \brief pending timers */
+    timer_wheel_t timers;
 
     /** \brief whether the context is intercepting blocking (I/O) handler */
     bool intercepting = false;
@@ -7,10 +7,36 @@
 //
 
 #include "forward.hpp"
+#include <cstdint>
 #include <memory>
 
 namespace rotor {
 
+struct timer_handler_base_t;
+
+/** \struct timer_link_t
+ *  \brief the position of the timer handler within the timer wheel
+ *
+ * It is embedded into the handler, so the wheel does not allocate
+ * upon timer start or cancellation. It is managed by the wheel only.
+ */
+struct timer_link_t {
+    /** \brief slot value of the handler, which is not in the wheel */
+    static constexpr unsigned detached = ~0u;
+
+    /** \brief previous handler in the wheel slot */
+    timer_handler_base_t *prev = nullptr;
+
+    /** \brief next handler in the wheel slot */
+    timer_handler_base_t *next = nullptr;
+
+    /** \brief the tick, when the timer expires */
+    std::uint64_t expiry = 0;
+
+    /** \brief the wheel slot, where the handler is linked to */
+    unsigned slot = detached;
+};
+
 /** \struct timer_handler_base_t
  *  \brief Base class for timer handler
  */
@@ -22,6 +48,9 @@ struct timer_handler_base_t {
     /** \brief timer identity (aka timer request id) */
     request_id_t request_id;
 
+    /** \brief the links within the timer wheel of the supervisor (if it uses one) */
+    timer_link_t wheel_link;
+
     /** \brief constructs timer handler from non-owning pointer to timer and timer request id */
     timer_handler_base_t(actor_base_t *owner_, request_id_t request_id_) noexcept
         : owner{owner_}, request_id{request_id_} {}
@@ -0,0 +1,118 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/timer_handler.hpp"
+#include "rotor/export.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+namespace rotor {
+
+/** \struct timer_wheel_t
+ *  \brief hashed hierarchical timer wheel with O(1) timer start and cancellation
+ *
+ * The time is split into ticks (1 millisecond each), the timer deadline is
+ * rounded up to the tick, i.e. the timer never fires earlier than its deadline.
+ *
+ * There are `levels` wheels of `slots` slots each; a slot of level `N` covers
+ * `slots^N` ticks. The timer is placed into the lowest level, which is able
+ * to hold its deadline; when the time comes, the timers of the higher level slot
+ * are cascaded into the lower levels, and the timers of level 0 slot are expired.
+ * The timers, which do not fit into the highest level, are kept in the overflow
+ * list and are re-examined once per full turn of the highest level.
+ *
+ * The wheel is intrusive: the slot lists are threaded through the `wheel_link`
+ * of the timer handlers, so starting and cancelling a timer do not allocate.
+ * The handler must outlive its presence in the wheel.
+ *
+ * The wheel is not thread-safe; it is used by the event loop backends, which
+ * need to multiplex rotor timers into a single native timer.
+ *
+ */
+struct ROTOR_API timer_wheel_t {
+    /** \brief an alias for monotonic clock */
+    using clock_t = std::chrono::steady_clock;
+
+    /** \brief wheel resolution */
+    using tick_t = std::chrono::milliseconds;
+
+    /** \brief number of bits of tick, handled by single level */
+    static constexpr unsigned slot_bits = 6;
+
+    /** \brief amount of slots per level */
+    static constexpr unsigned slots = 1u << slot_bits;
+
+    /** \brief amount of levels */
+    static constexpr unsigned levels = 4;
+
+    /** \brief constructs timer wheel, which starts ticking from the specified time point */
+    timer_wheel_t(const clock_t::time_point &origin) noexcept;
+
+    timer_wheel_t(const timer_wheel_t &) = delete;
+    timer_wheel_t(timer_wheel_t &&) = delete;
+
+    /** \brief schedules the timer handler (which must not be in a wheel) to be expired after the deadline */
+    void start(timer_handler_base_t &handler, const clock_t::time_point &deadline) noexcept;
+
+    /** \brief removes the handler from the wheel; returns `false` if it is not pending */
+    bool cancel(timer_handler_base_t &handler) noexcept;
+
+    /** \brief removes the next timer, expired at the specified time point, and returns its handler
+     *
+     * `nullptr` is returned if there are no more expired timers. It is safe to start
+     * or cancel timers between the calls.
+     */
+    timer_handler_base_t *pop_expired(const clock_t::time_point &now) noexcept;
+
+    /** \brief returns the time point, when the wheel should be checked for expired timers
+     *
+     * `clock_t::time_point::max()` is returned if there are no timers.
+     */
+    clock_t::time_point next_deadline() const noexcept;
+
+    /** \brief returns `true` if there are no pending timers */
+    inline bool empty() const noexcept { return pending == 0; }
+
+    /** \brief returns amount of pending timers */
+    inline std::size_t size() const noexcept { return pending; }
+
+  private:
+    static constexpr unsigned overflow_slot = levels * slots;
+    static constexpr unsigned expired_slot = overflow_slot + 1;
+
+    using node_t = timer_handler_base_t;
+    using heads_t = std::array<node_t *, expired_slot + 1>;
+    using occupied_t = std::array<std::uint64_t, levels>;
+
+    std::uint64_t to_tick(const clock_t::time_point &time_point, bool round_up) const noexcept;
+    void place(node_t &node) noexcept;
+    void link(node_t &node, unsigned slot) noexcept;
+    void unlink(node_t &node) noexcept;
+    void reinsert(unsigned slot) noexcept;
+    void advance(std::uint64_t target) noexcept;
+
+    clock_t::time_point origin;
+    std::uint64_t current;
+    std::size_t pending;
+    heads_t heads;
+    heads_t tails;
+    occupied_t occupied;
+};
+
+} // namespace rotor
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
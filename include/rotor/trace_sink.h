@@ -0,0 +1,52 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/export.h"
+#include <cstddef>
+
+namespace rotor {
+
+struct message_base_t;
+struct supervisor_t;
+
+/** \brief what happened with the traced message */
+enum class trace_event_t {
+    /** \brief the message has been delivered to the local recipients */
+    delivered,
+
+    /** \brief there are no recipients for the message */
+    discarded,
+
+    /** \brief the message has been forwarded to the supervisor of other locality */
+    forwarded,
+};
+
+/** \struct trace_sink_t
+ *  \brief Abstract receiver of the messages delivery traces
+ *
+ * The sink is invoked by the delivery plugin of the supervisor for each
+ * message taken from the supervisor queue, while tracing is enabled via
+ * `supervisor_t::trace()`. The sink is invoked on the supervisor thread
+ * only, i.e. it does not need any synchronization, if it is not shared
+ * between supervisors of different threads; it should be fast and must
+ * not block.
+ *
+ */
+struct ROTOR_API trace_sink_t {
+    virtual ~trace_sink_t() = default;
+
+    /** \brief records the event of the message processing by the supervisor
+     *
+     * The `queue_depth` is the amount of messages, which are still pending
+     * in the supervisor queue.
+     */
+    virtual void record(const supervisor_t &supervisor, const message_base_t &message, trace_event_t event,
+                        std::size_t queue_depth) noexcept = 0;
+};
+
+} // namespace rotor
@@ -53,6 +53,7 @@ struct ROTOR_WX_API supervisor_wx_t : public supervisor_t {
     void start() noexcept override;
     void shutdown() noexcept override;
     void enqueue(message_ptr_t message) noexcept override;
+    void enqueue_batch(messages_queue_t &messages) noexcept override;
     // void on_timer_trigger(request_id_t timer_id) noexcept override;
 
     /** \brief returns pointer to the wx system context */
@@ -82,7 +83,7 @@ struct ROTOR_WX_API supervisor_wx_t : public supervisor_t {
     friend struct timer_t;
 
     void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    void do_cancel_timer(request_id_t timer_id) noexcept override;
+    void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
 
     /** \brief unique pointer to timer */
     using timer_ptr_t = std::unique_ptr<timer_t>;
@@ -132,7 +132,7 @@ void actor_base_t::shutdown_finish() noexcept {
         cancel_timer(timers_map.begin()->first);
     }
     while (!active_requests.empty()) {
-        supervisor->do_cancel_timer(*active_requests.begin());
+        supervisor->cancel_request_timer(active_requests.front());
     }
     /*
     if (!deactivating_plugins.empty()) {
@@ -255,11 +255,18 @@ plugin_base_t *actor_base_t::get_plugin(const std::type_index &identity_) const
 }
 
 void actor_base_t::cancel_timer(request_id_t request_id) noexcept {
-    assert(timers_map.find(request_id) != timers_map.end() && "request does exist");
-    supervisor->do_cancel_timer(request_id);
+    if (request_slots_t::is_request(request_id)) {
+        return supervisor->cancel_request_timer(request_id);
+    }
+    auto it = timers_map.find(request_id);
+    assert(it != timers_map.end() && "request does exist");
+    supervisor->do_cancel_timer(*it->second);
 }
 
 void actor_base_t::on_timer_trigger(request_id_t request_id, bool cancelled) noexcept {
+    if (request_slots_t::is_request(request_id)) {
+        return supervisor->on_request_trigger(request_id, cancelled);
+    }
     auto it = timers_map.find(request_id);
     if (it != timers_map.end()) {
         it->second->trigger(cancelled);
@@ -6,6 +6,7 @@
 
 #include "rotor/asio/supervisor_asio.h"
 #include "rotor/asio/forwarder.hpp"
+#include <cassert>
 
 using namespace rotor::asio;
 using namespace rotor;
@@ -27,65 +28,105 @@ inline auto rotor::actor_base_t::access<to::on_timer_trigger, request_id_t, bool
 } // namespace rotor
 
 supervisor_asio_t::supervisor_asio_t(supervisor_config_asio_t &config_)
-    : supervisor_t{config_}, strand{config_.strand} {
+    : supervisor_t{config_}, strand{config_.strand}, executor{config_.executor}, timers{clock_t::now()},
+      timer{get_io_executor()}, armed_deadline{clock_t::time_point::max()} {
+    assert((strand || executor) && "strand or executor should be set");
     if (config_.guard_context) {
-        guard = std::make_unique<guard_t>(asio::make_work_guard(strand->context()));
+        guard = std::make_unique<guard_t>(asio::make_work_guard(get_io_executor()));
     }
 }
 
-rotor::address_ptr_t supervisor_asio_t::make_address() noexcept { return instantiate_address(strand.get()); }
+rotor::address_ptr_t supervisor_asio_t::make_address() noexcept {
+    if (strand) {
+        return instantiate_address(strand.get());
+    }
+    return instantiate_address(executor.get());
+}
+
+auto supervisor_asio_t::get_io_executor() noexcept -> executor_t {
+    if (strand) {
+        return strand->context().get_executor();
+    }
+    return *executor;
+}
 
 void supervisor_asio_t::start() noexcept { create_forwarder (&supervisor_asio_t::do_process)(); }
 
 void supervisor_asio_t::shutdown() noexcept { create_forwarder (&supervisor_asio_t::invoke_shutdown)(); }
 
 void supervisor_asio_t::do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept {
-    using namespace asio::chrono;
-    auto timer = std::make_unique<timer_t>(&handler, strand->context());
-    auto micro_seconds = microseconds(interval.total_microseconds());
-    timer->expires_after(duration_cast<timer_t::duration>(micro_seconds));
-
-    intrusive_ptr_t<supervisor_asio_t> self(this);
-    request_id_t timer_id = handler.request_id;
-    timer->async_wait([self = self, timer_id = timer_id](const boost::system::error_code &ec) {
-        auto &strand = self->get_strand();
-        if (!ec) {
-            asio::defer(strand, [self = self, timer_id = timer_id]() {
-                auto &sup = *self;
-                auto &timers_map = sup.timers_map;
-                auto it = timers_map.find(timer_id);
-                if (it != timers_map.end()) {
-                    auto actor_ptr = it->second->handler->owner;
-                    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(timer_id, false);
-                    timers_map.erase(timer_id);
-                    sup.do_process();
-                }
-            });
-        }
-    });
-    timers_map.emplace(timer_id, std::move(timer));
+    auto deadline = clock_t::now() + std::chrono::microseconds(interval.total_microseconds());
+    timers.start(handler, deadline);
+    arm_timer();
 }
 
-void supervisor_asio_t::do_cancel_timer(request_id_t timer_id) noexcept {
-    auto &timer = timers_map.at(timer_id);
-    boost::system::error_code ec;
-    timer->cancel(ec);
+void supervisor_asio_t::do_cancel_timer(timer_handler_base_t &handler) noexcept {
+    auto found = timers.cancel(handler);
+    assert(found && "timer has been found");
+    (void)found;
+    if (timers.empty() && armed_deadline != clock_t::time_point::max()) {
+        // do not keep io_context busy (and the supervisor alive), when there are no more timers
+        armed_deadline = clock_t::time_point::max();
+        timer.cancel();
+    }
+    auto actor_ptr = handler.owner;
+    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler.request_id, true);
+}
 
-    auto &actor_ptr = timer->handler->owner;
-    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(timer_id, true);
-    timers_map.erase(timer_id);
-    // ignore the possible error, caused the case when timer is not cancelleable
-    // if (ec) { ... }
+void supervisor_asio_t::arm_timer() noexcept {
+    auto deadline = timers.next_deadline();
+    if (deadline >= armed_deadline) {
+        return;
+    }
+    armed_deadline = deadline;
+    timer.expires_at(deadline);
+    auto handler = [self = supervisor_ptr_t(this)](const sys::error_code &ec) { self->on_timer(ec); };
+    if (strand) {
+        timer.async_wait(asio::bind_executor(*strand, std::move(handler)));
+    } else {
+        timer.async_wait(asio::bind_executor(*executor, std::move(handler)));
+    }
+}
+
+void supervisor_asio_t::on_timer(const sys::error_code &ec) noexcept {
+    if (ec) {
+        // the timer has been re-armed or cancelled
+        return;
+    }
+    armed_deadline = clock_t::time_point::max();
+    auto now = clock_t::now();
+    while (auto handler = timers.pop_expired(now)) {
+        auto actor_ptr = handler->owner;
+        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler->request_id, false);
+    }
+    arm_timer();
+    do_process();
 }
 
 void supervisor_asio_t::enqueue(rotor::message_ptr_t message) noexcept {
     auto leader = static_cast<supervisor_asio_t *>(locality_leader);
     auto &inbound = leader->inbound_queue;
     inbound.push(message.detach());
+    wakeup();
+}
+
+void supervisor_asio_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    auto leader = static_cast<supervisor_asio_t *>(locality_leader);
+    auto &inbound = leader->inbound_queue;
+    while (!messages.empty()) {
+        inbound.push(messages.take_front().detach());
+    }
+    wakeup();
+}
+
+void supervisor_asio_t::wakeup() noexcept {
+    auto leader = static_cast<supervisor_asio_t *>(locality_leader);
+    if (leader->wakeup_pending.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
 
-    auto actor_ptr = supervisor_ptr_t(this);
-    asio::defer(get_strand(), [actor = std::move(actor_ptr)]() mutable {
-        auto &sup = *actor;
+    defer_handler([actor = supervisor_ptr_t(this)]() {
+        auto &sup = static_cast<supervisor_asio_t &>(*actor);
         sup.do_process();
     });
 }
@@ -109,13 +150,21 @@ void supervisor_asio_t::do_process() noexcept {
     auto leader = static_cast<supervisor_asio_t *>(locality_leader);
     auto &inbound = leader->inbound_queue;
     auto &leader_queue = leader->queue;
+    auto &wakeup_pending = leader->wakeup_pending;
     auto enqueued_messages = size_t{0};
     message_base_t *ptr;
-    while (inbound.pop(ptr)) {
-        leader_queue.emplace_back(ptr, false);
-    }
-    if (!leader_queue.empty()) {
-        enqueued_messages = supervisor_t::do_process();
+    while (true) {
+        while (inbound.pop(ptr)) {
+            leader_queue.emplace_back(ptr, false);
+        }
+        if (!leader_queue.empty()) {
+            enqueued_messages += supervisor_t::do_process();
+        }
+        // let producers wake up the strand again, unless there are late messages
+        wakeup_pending.exchange(false, std::memory_order_acq_rel);
+        if (inbound.empty() || wakeup_pending.exchange(true, std::memory_order_acq_rel)) {
+            break;
+        }
     }
 
     auto total_microsecs = poll_duration.total_microseconds();
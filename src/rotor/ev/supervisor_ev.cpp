@@ -5,6 +5,8 @@
 //
 
 #include "rotor/ev/supervisor_ev.h"
+#include <algorithm>
+#include <chrono>
 
 using namespace rotor;
 using namespace rotor::ev;
@@ -13,7 +15,6 @@ namespace rotor::ev {
 namespace {
 namespace to {
 struct on_timer_trigger {};
-struct timers_map {};
 } // namespace to
 } // namespace
 } // namespace rotor::ev
@@ -24,9 +25,6 @@ inline auto rotor::actor_base_t::access<to::on_timer_trigger, request_id_t, bool
                                                                                   bool cancelled) noexcept {
     on_timer_trigger(request_id, cancelled);
 }
-
-template <> inline auto &rotor::ev::supervisor_ev_t::access<to::timers_map>() noexcept { return timers_map; }
-
 } // namespace rotor
 
 void supervisor_ev_t::async_cb(struct ev_loop *, ev_async *w, int revents) noexcept {
@@ -36,29 +34,20 @@ void supervisor_ev_t::async_cb(struct ev_loop *, ev_async *w, int revents) noexc
     sup->on_async();
 }
 
-static void timer_cb(struct ev_loop *, ev_timer *w, int revents) noexcept {
+void supervisor_ev_t::timer_cb(struct ev_loop *, ev_timer *w, int revents) noexcept {
     assert(revents & EV_TIMER);
     (void)revents;
     auto *sup = static_cast<supervisor_ev_t *>(w->data);
-    auto timer = static_cast<supervisor_ev_t::timer_t *>(w);
-    auto timer_id = timer->handler->request_id;
-    auto &timers_map = sup->access<to::timers_map>();
-
-    try {
-        auto actor_ptr = timers_map.at(timer_id)->handler->owner;
-        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(timer_id, false);
-        timers_map.erase(timer_id);
-        sup->do_process();
-    } catch (std::out_of_range &) {
-        // no-op
-    }
-    intrusive_ptr_release(sup);
+    sup->on_timer();
 }
 
 supervisor_ev_t::supervisor_ev_t(supervisor_config_ev_t &config_)
     : supervisor_t{config_}, loop{config_.loop}, loop_ownership{config_.loop_ownership},
-      poll_duration{static_cast<ev_tstamp>(supervisor_t::poll_duration.total_nanoseconds()) / 1000000000} {
+      poll_duration{static_cast<ev_tstamp>(supervisor_t::poll_duration.total_nanoseconds()) / 1000000000},
+      timers{clock_t::now()}, armed_deadline{clock_t::time_point::max()} {
     ev_async_init(&async_watcher, async_cb);
+    ev_init(&timer_watcher, timer_cb);
+    timer_watcher.data = this;
 }
 
 void supervisor_ev_t::do_initialize(system_context_t *ctx) noexcept {
@@ -74,6 +63,15 @@ void supervisor_ev_t::enqueue(rotor::message_ptr_t message) noexcept {
     ev_async_send(loop, &async_watcher);
 }
 
+void supervisor_ev_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    auto leader = static_cast<supervisor_ev_t *>(locality_leader);
+    auto &inbound = leader->inbound_queue;
+    while (!messages.empty()) {
+        inbound.push(messages.take_front().detach());
+    }
+    ev_async_send(loop, &async_watcher);
+}
+
 void supervisor_ev_t::start() noexcept { ev_async_send(loop, &async_watcher); }
 
 void supervisor_ev_t::shutdown_finish() noexcept {
@@ -90,29 +88,54 @@ void supervisor_ev_t::shutdown() noexcept {
 }
 
 void supervisor_ev_t::do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept {
-    auto timer = std::make_unique<timer_t>();
-    auto timer_ptr = timer.get();
-    ev_tstamp ev_timeout = static_cast<ev_tstamp>(interval.total_nanoseconds()) / 1000000000;
-    ev_timer_init(timer_ptr, timer_cb, ev_timeout, 0);
-    timer_ptr->handler = &handler;
-    timer_ptr->data = this;
-
-    ev_timer_start(loop, timer_ptr);
-    intrusive_ptr_add_ref(this);
-    timers_map.emplace(handler.request_id, std::move(timer));
-}
-
-void supervisor_ev_t::do_cancel_timer(request_id_t timer_id) noexcept {
-    try {
-        auto &timer = timers_map.at(timer_id);
-        ev_timer_stop(loop, timer.get());
-        auto actor_ptr = timer->handler->owner;
-        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(timer_id, true);
-        timers_map.erase(timer_id);
+    auto deadline = clock_t::now() + std::chrono::microseconds(interval.total_microseconds());
+    timers.start(handler, deadline);
+    arm_timer();
+}
+
+void supervisor_ev_t::do_cancel_timer(timer_handler_base_t &handler) noexcept {
+    if (!timers.cancel(handler)) {
+        return;
+    }
+    if (timers.empty() && ev_is_active(&timer_watcher)) {
+        // do not keep the loop (and the supervisor) alive, when there are no more timers
+        ev_timer_stop(loop, &timer_watcher);
+        armed_deadline = clock_t::time_point::max();
         intrusive_ptr_release(this);
-    } catch (std::out_of_range &) {
-        // no-op
     }
+    auto actor_ptr = handler.owner;
+    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler.request_id, true);
+}
+
+void supervisor_ev_t::arm_timer() noexcept {
+    auto deadline = timers.next_deadline();
+    if (deadline >= armed_deadline) {
+        return;
+    }
+    armed_deadline = deadline;
+    auto delay = std::chrono::duration<ev_tstamp>(deadline - clock_t::now()).count();
+    if (ev_is_active(&timer_watcher)) {
+        ev_timer_stop(loop, &timer_watcher);
+    } else {
+        intrusive_ptr_add_ref(this);
+    }
+    ev_timer_set(&timer_watcher, std::max(delay, ev_tstamp{0}), 0.);
+    ev_timer_start(loop, &timer_watcher);
+}
+
+void supervisor_ev_t::on_timer() noexcept {
+    // the watcher is not active any longer, but the reference is still held
+    armed_deadline = clock_t::time_point::max();
+    auto now = clock_t::now();
+    while (auto handler = timers.pop_expired(now)) {
+        auto actor_ptr = handler->owner;
+        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler->request_id, false);
+    }
+    arm_timer();
+    do_process();
+    // the reference of the fired watcher; if the watcher has been restarted,
+    // the new reference has been taken in arm_timer()
+    intrusive_ptr_release(this);
 }
 
 void supervisor_ev_t::on_async() noexcept {
@@ -62,7 +62,8 @@ void supervisor_fltk_t::do_start_timer(const pt::time_duration &interval, timer_
     intrusive_ptr_add_ref(this);
 }
 
-void supervisor_fltk_t::do_cancel_timer(request_id_t timer_id) noexcept {
+void supervisor_fltk_t::do_cancel_timer(timer_handler_base_t &handler) noexcept {
+    auto timer_id = handler.request_id;
     try {
         auto &timer = timers_map.at(timer_id);
         Fl::remove_timeout(on_timeout, timer.get());
@@ -79,6 +80,10 @@ void supervisor_fltk_t::enqueue(message_ptr_t message) noexcept {
     static_cast<system_context_fltk_t *>(context)->enqueue(std::move(message));
 }
 
+void supervisor_fltk_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    static_cast<system_context_fltk_t *>(context)->enqueue_batch(messages);
+}
+
 void supervisor_fltk_t::start() noexcept {
     intrusive_ptr_add_ref(this);
     Fl::awake(
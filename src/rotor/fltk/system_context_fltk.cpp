@@ -56,3 +56,17 @@ void system_context_fltk_t::enqueue(message_ptr_t message) noexcept {
         }
     }
 }
+
+void system_context_fltk_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    auto sup = get_supervisor().get();
+    if (sup) {
+        auto &inbound = sup->access<to::inbound_queue>();
+        auto count = static_cast<std::int32_t>(messages.size());
+        while (!messages.empty()) {
+            inbound.push(messages.take_front().detach());
+        }
+        if (queue_counter.fetch_add(count) == 0) {
+            Fl::awake(_callback, sup);
+        }
+    }
+}
@@ -31,8 +31,8 @@ struct continuation_impl_t final : continuation_t {
     message_ptr_t &message;
 };
 
-handler_base_t::handler_base_t(actor_base_t &actor, const void *handler_type_) noexcept
-    : handler_type{handler_type_}, actor_ptr{&actor} {
+handler_base_t::handler_base_t(actor_base_t &actor, const void *handler_type_, dispatcher_t dispatcher_) noexcept
+    : handler_type{handler_type_}, actor_ptr{&actor}, dispatcher{dispatcher_} {
     auto h1 = reinterpret_cast<std::size_t>(handler_type);
     auto h2 = reinterpret_cast<std::size_t>(&actor);
     precalc_hash = h1 ^ (h2 << 1);
@@ -41,22 +41,31 @@ handler_base_t::handler_base_t(actor_base_t &actor, const void *handler_type_) n
 
 handler_base_t::~handler_base_t() { intrusive_ptr_release(actor_ptr); }
 
+void handler_base_t::call_virtual(handler_base_t &self, message_ptr_t &message) noexcept { self.call(message); }
+
 handler_ptr_t handler_base_t::upgrade(const void *tag) noexcept {
     handler_ptr_t self(this);
     return handler_ptr_t(new handler_intercepted_t(self, tag));
 }
 
 handler_intercepted_t::handler_intercepted_t(handler_ptr_t backend_, const void *tag_) noexcept
-    : handler_base_t(*backend_->actor_ptr, backend_->handler_type), backend{std::move(backend_)}, tag{tag_} {}
+    : handler_base_t(*backend_->actor_ptr, backend_->handler_type, &handler_intercepted_t::intercept),
+      backend{std::move(backend_)}, tag{tag_} {}
 
 void handler_intercepted_t::call(message_ptr_t &message) noexcept {
     if (select(message)) {
-        auto &sup = actor_ptr->get_supervisor();
-        continuation_impl_t continuation(*this, message);
-        sup.access<to::intercept, message_ptr_t &, const void *, const continuation_t &>(message, tag, continuation);
+        intercept(*this, message);
     }
 }
 
+void handler_intercepted_t::intercept(handler_base_t &self, message_ptr_t &message) noexcept {
+    auto &handler = static_cast<handler_intercepted_t &>(self);
+    auto &sup = handler.actor_ptr->get_supervisor();
+    continuation_impl_t continuation(handler, message);
+    sup.access<to::intercept, message_ptr_t &, const void *, const continuation_t &>(message, handler.tag,
+                                                                                     continuation);
+}
+
 bool handler_intercepted_t::select(message_ptr_t &message) noexcept { return backend->select(message); }
 
 void handler_intercepted_t::call_no_check(message_ptr_t &message) noexcept { return backend->call_no_check(message); }
@@ -0,0 +1,37 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/inbound_queue.h"
+
+using namespace rotor;
+
+inbound_queue_t::inbound_queue_t(bool intrusive_)
+    : intrusive{intrusive_}, queue(0), stack{nullptr}, batch{nullptr} {}
+
+inbound_queue_t::~inbound_queue_t() {
+    message_base_t *ptr;
+    while (pop(ptr)) {
+        intrusive_ptr_release(ptr);
+    }
+}
+
+void inbound_queue_t::reserve_unsafe(std::size_t size) {
+    if (!intrusive) {
+        queue.reserve_unsafe(size);
+    }
+}
+
+message_base_t *inbound_queue_t::detach_batch() noexcept {
+    auto head = stack.exchange(nullptr, std::memory_order_acquire);
+    message_base_t *reversed = nullptr;
+    while (head) {
+        auto next = head->next_inbound;
+        head->next_inbound = reversed;
+        reversed = head;
+        head = next;
+    }
+    return reversed;
+}
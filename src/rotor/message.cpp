@@ -7,21 +7,100 @@
 #include "rotor/message.h"
 #include <unordered_map>
 
-using type_map_t = std::unordered_map<std::string_view, const void *>;
+namespace {
+struct type_record_t {
+    const void *ptr;
+    rotor::message_type_id_t id;
+};
 
-namespace rotor::message_support {
+using type_map_t = std::unordered_map<std::string_view, type_record_t>;
 
-const void *register_type(const std::type_index &type_index) noexcept {
+type_map_t &get_type_map() noexcept {
     static type_map_t type_map = {};
+    return type_map;
+}
 
+const type_record_t &get_record(const std::type_index &type_index) noexcept {
+    auto &type_map = get_type_map();
     auto name = std::string_view(type_index.name());
     auto it = type_map.find(name);
-    if (it != type_map.end()) {
-        return it->second;
+    if (it == type_map.end()) {
+        auto ptr = static_cast<const void *>(type_index.name());
+        auto id = static_cast<rotor::message_type_id_t>(type_map.size() + 1);
+        it = type_map.emplace(name, type_record_t{ptr, id}).first;
     }
-    auto ptr = static_cast<const void *>(type_index.name());
-    type_map[name] = ptr;
-    return ptr;
+    return it->second;
+}
+} // namespace
+
+namespace rotor::message_support {
+
+const void *register_type(const std::type_index &type_index) noexcept { return get_record(type_index).ptr; }
+
+message_type_id_t register_type_id(const std::type_index &type_index) noexcept { return get_record(type_index).id; }
+
+message_type_id_t type_ids_bound() noexcept { return static_cast<message_type_id_t>(get_type_map().size() + 1); }
+
+void release_pooled(const message_base_t *message) noexcept {
+    auto ptr = const_cast<message_base_t *>(message);
+    auto pool = ptr->pool;
+    auto memory = dynamic_cast<void *>(ptr);
+    ptr->~message_base_t();
+    pool->deallocate(memory);
 }
 
 } // namespace rotor::message_support
+
+namespace rotor {
+
+messages_queue_t::messages_queue_t(const messages_queue_t &other) {
+    auto count = other.size();
+    while (capacity < count) {
+        grow();
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        push_back(other.slots[(other.head + i) & other.mask]);
+    }
+}
+
+messages_queue_t::messages_queue_t(messages_queue_t &&other) noexcept
+    : slots{std::move(other.slots)}, capacity{other.capacity}, mask{other.mask}, head{other.head}, tail{other.tail} {
+    other.capacity = other.mask = other.head = other.tail = 0;
+}
+
+messages_queue_t &messages_queue_t::operator=(const messages_queue_t &other) {
+    if (this != &other) {
+        *this = messages_queue_t(other);
+    }
+    return *this;
+}
+
+messages_queue_t &messages_queue_t::operator=(messages_queue_t &&other) noexcept {
+    if (this != &other) {
+        clear();
+        slots = std::move(other.slots);
+        capacity = other.capacity;
+        mask = other.mask;
+        head = other.head;
+        tail = other.tail;
+        other.capacity = other.mask = other.head = other.tail = 0;
+    }
+    return *this;
+}
+
+void messages_queue_t::grow() {
+    static constexpr std::size_t initial_capacity = 64;
+    auto new_capacity = capacity ? capacity * 2 : initial_capacity;
+    auto new_slots = slots_t(new value_type[new_capacity]);
+    auto count = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        new_slots[i] = std::move(slots[(head + i) & mask]);
+    }
+    slots = std::move(new_slots);
+    capacity = new_capacity;
+    mask = new_capacity - 1;
+    head = 0;
+    tail = count;
+}
+
+} // namespace rotor
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/message_pool.h"
+#include <new>
+
+using namespace rotor;
+
+static thread_local message_pool_t *current_pool = nullptr;
+
+// marks the return stack of the orphaned pool
+message_pool_t::block_t *const message_pool_t::orphaned_mark = reinterpret_cast<block_t *>(alignment);
+
+message_pool_t::guard_t::guard_t(message_pool_t *pool) noexcept : previous{current_pool} { current_pool = pool; }
+
+message_pool_t::guard_t::~guard_t() { current_pool = previous; }
+
+message_pool_t *message_pool_t::current() noexcept { return current_pool; }
+
+namespace rotor {
+
+void intrusive_ptr_add_ref(message_pool_t *pool) noexcept { counter_policy_t::increment(pool->owners); }
+
+void intrusive_ptr_release(message_pool_t *pool) noexcept {
+    if (counter_policy_t::decrement(pool->owners) == 0) {
+        pool->orphan();
+    }
+}
+
+} // namespace rotor
+
+message_pool_t::message_pool_t() noexcept : owners(0), outstanding{0}, returned{nullptr}, remaining{0} {
+    free_lists.fill(nullptr);
+}
+
+message_pool_t::~message_pool_t() {
+    for (auto block : free_lists) {
+        while (block) {
+            auto next = block->next;
+            ::operator delete(static_cast<void *>(block));
+            block = next;
+        }
+    }
+}
+
+void message_pool_t::orphan() noexcept {
+    // the extra unit keeps the pool alive until the orphaning thread is done with it
+    remaining.store(outstanding + 1, std::memory_order_relaxed);
+    auto block = returned.exchange(orphaned_mark, std::memory_order_acq_rel);
+    std::size_t reclaimed = 0;
+    while (block) {
+        auto next = block->next;
+        ::operator delete(static_cast<void *>(block));
+        block = next;
+        ++reclaimed;
+    }
+    if (remaining.fetch_sub(reclaimed + 1, std::memory_order_acq_rel) == reclaimed + 1) {
+        delete this;
+    }
+}
+
+void *message_pool_t::allocate(std::size_t size) {
+    if (size > max_size) {
+        return nullptr;
+    }
+    auto size_class = size ? (size - 1) / granularity : 0;
+    auto &head = free_lists[size_class];
+    if (!head) {
+        reclaim();
+    }
+    auto block = head;
+    if (block) {
+        head = block->next;
+    } else {
+        auto memory = ::operator new(sizeof(block_t) + (size_class + 1) * granularity);
+        block = new (memory) block_t{nullptr, size_class};
+    }
+    ++outstanding;
+    return block + 1;
+}
+
+void message_pool_t::deallocate(void *ptr) noexcept {
+    auto block = static_cast<block_t *>(ptr) - 1;
+#if !defined(ROTOR_REFCOUNT_THREADUNSAFE)
+    bool local = current_pool == this;
+#else
+    bool local = returned.load(std::memory_order_relaxed) != orphaned_mark;
+#endif
+    if (!local) {
+        return give_back(block);
+    }
+    auto &head = free_lists[block->size_class];
+    block->next = head;
+    head = block;
+    --outstanding;
+}
+
+void message_pool_t::give_back(block_t *block) noexcept {
+    auto head = returned.load(std::memory_order_acquire);
+    do {
+        if (head == orphaned_mark) {
+            ::operator delete(static_cast<void *>(block));
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+            return;
+        }
+        block->next = head;
+    } while (!returned.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_acquire));
+}
+
+void message_pool_t::reclaim() noexcept {
+    auto block = returned.exchange(nullptr, std::memory_order_acquire);
+    while (block) {
+        auto next = block->next;
+        auto &head = free_lists[block->size_class];
+        block->next = head;
+        head = block;
+        block = next;
+        --outstanding;
+    }
+}
@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/misc/binary_trace_sink.h"
+#include "rotor/message.h"
+#include "rotor/supervisor.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace bi = boost::interprocess;
+
+namespace rotor::misc {
+
+struct binary_trace_sink_t::mapping_t {
+    bi::file_mapping file;
+    bi::mapped_region region;
+};
+
+binary_trace_sink_t::binary_trace_sink_t(const std::string &path, std::size_t capacity, std::uint32_t max_types,
+                                         std::size_t names_capacity)
+    : known_types(max_types, false) {
+    assert(capacity && "trace ring should not be empty");
+    assert(names_capacity < trace_type_name_t::lost_offset && "names area is too large");
+    auto table_size = std::size_t{max_types} * sizeof(trace_type_name_t);
+    auto size = sizeof(trace_file_header_t) + table_size + names_capacity + capacity * sizeof(trace_record_t);
+    {
+        std::filebuf buff;
+        buff.open(path, std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        buff.pubseekoff(static_cast<std::streamoff>(size - 1), std::ios_base::beg);
+        buff.sputc(0);
+    }
+    auto file = bi::file_mapping(path.c_str(), bi::read_write);
+    auto region = bi::mapped_region(file, bi::read_write);
+    mapping.reset(new mapping_t{std::move(file), std::move(region)});
+
+    auto ptr = static_cast<char *>(mapping->region.get_address());
+    std::memset(ptr, 0, size);
+    header = reinterpret_cast<trace_file_header_t *>(ptr);
+    type_names = reinterpret_cast<trace_type_name_t *>(ptr + sizeof(trace_file_header_t));
+    names = reinterpret_cast<char *>(type_names + max_types);
+    records = reinterpret_cast<trace_record_t *>(names + names_capacity);
+
+    header->magic = trace_file_header_t::magic_value;
+    header->record_size = static_cast<std::uint32_t>(sizeof(trace_record_t));
+    header->max_types = max_types;
+    header->capacity = capacity;
+    header->written = 0;
+    header->names_capacity = names_capacity;
+    header->names_used = 0;
+}
+
+binary_trace_sink_t::~binary_trace_sink_t() { mapping->region.flush(); }
+
+void binary_trace_sink_t::record(const supervisor_t &supervisor, const message_base_t &message, trace_event_t event,
+                                 std::size_t queue_depth) noexcept {
+    using clock_t = std::chrono::steady_clock;
+    auto type_id = message.type_id;
+    if (type_id < known_types.size() && !known_types[type_id]) {
+        auto name = static_cast<const char *>(message.type_index);
+        auto length = std::strlen(name);
+        auto &entry = type_names[type_id];
+        entry.length = static_cast<std::uint32_t>(length);
+        if (length <= header->names_capacity - header->names_used) {
+            entry.offset = static_cast<std::uint32_t>(header->names_used);
+            std::memcpy(names + header->names_used, name, length);
+            header->names_used += length;
+        } else {
+            entry.offset = trace_type_name_t::lost_offset;
+        }
+        known_types[type_id] = true;
+    }
+
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now().time_since_epoch());
+    auto &record = records[header->written % header->capacity];
+    record.timestamp = static_cast<std::uint64_t>(now.count());
+    record.supervisor = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&supervisor));
+    record.address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(message.address.get()));
+    record.type_id = type_id;
+    record.queue_depth = static_cast<std::uint32_t>(queue_depth);
+    record.event = static_cast<std::uint32_t>(event);
+    ++header->written;
+}
+
+} // namespace rotor::misc
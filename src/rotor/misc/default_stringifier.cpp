@@ -9,6 +9,7 @@
 #include "rotor/misc/default_stringifier.h"
 
 #include <boost/core/demangle.hpp>
+#include <algorithm>
 
 namespace rotor::misc {
 
@@ -34,67 +35,37 @@ std::ostream &operator<<(std::ostream &stream, const subscription_point_t &p) {
                   << "}";
 }
 
+template <typename Message>
+void default_stringifier_t::visit(default_stringifier_t &self, const message_base_t &message, void *context) {
+    self.on(static_cast<const Message &>(message), context);
+}
+
+template <typename... Messages> auto default_stringifier_t::make_visitors() noexcept -> visitors_t {
+    visitors_t visitors(std::max({Messages::message_type_id...}) + 1, nullptr);
+    ((visitors[Messages::message_type_id] = &default_stringifier_t::visit<Messages>), ...);
+    return visitors;
+}
+
+auto default_stringifier_t::get_visitors() noexcept -> const visitors_t & {
+    namespace m = message;
+    static const visitors_t visitors = make_visitors<
+        m::unsubscription_t, m::unsubscription_external_t, m::subscription_t, m::external_subscription_t,
+        m::commit_unsubscription_t, m::handler_call_t, m::init_request_t, m::init_response_t, m::start_trigger_t,
+        m::shutdown_trigger_t, m::shutdown_request_t, m::shutdown_response_t, m::create_actor_t, m::spawn_actor_t,
+        m::registration_request_t, m::registration_response_t, m::deregistration_notify_t, m::deregistration_service_t,
+        m::discovery_request_t, m::discovery_response_t, m::discovery_promise_t, m::discovery_future_t,
+        m::discovery_cancel_t, m::link_request_t, m::link_response_t, m::unlink_notify_t, m::unlink_request_t,
+        m::unlink_response_t>();
+    return visitors;
+}
+
 bool default_stringifier_t::try_visit(const message_base_t &message, void *context) const {
-    auto &self = const_cast<default_stringifier_t &>(*this);
-    if (message.type_index == message::unsubscription_t::message_type) {
-        self.on(static_cast<const message::unsubscription_t &>(message), context);
-    } else if (message.type_index == message::unsubscription_external_t::message_type) {
-        self.on(static_cast<const message::unsubscription_external_t &>(message), context);
-    } else if (message.type_index == message::subscription_t::message_type) {
-        self.on(static_cast<const message::subscription_t &>(message), context);
-    } else if (message.type_index == message::external_subscription_t::message_type) {
-        self.on(static_cast<const message::external_subscription_t &>(message), context);
-    } else if (message.type_index == message::commit_unsubscription_t::message_type) {
-        self.on(static_cast<const message::commit_unsubscription_t &>(message), context);
-    } else if (message.type_index == message::handler_call_t::message_type) {
-        self.on(static_cast<const message::handler_call_t &>(message), context);
-    } else if (message.type_index == message::init_request_t::message_type) {
-        self.on(static_cast<const message::init_request_t &>(message), context);
-    } else if (message.type_index == message::init_response_t::message_type) {
-        self.on(static_cast<const message::init_response_t &>(message), context);
-    } else if (message.type_index == message::start_trigger_t::message_type) {
-        self.on(static_cast<const message::start_trigger_t &>(message), context);
-    } else if (message.type_index == message::shutdown_trigger_t::message_type) {
-        self.on(static_cast<const message::shutdown_trigger_t &>(message), context);
-    } else if (message.type_index == message::shutdown_request_t::message_type) {
-        self.on(static_cast<const message::shutdown_request_t &>(message), context);
-    } else if (message.type_index == message::shutdown_response_t::message_type) {
-        self.on(static_cast<const message::shutdown_response_t &>(message), context);
-    } else if (message.type_index == message::create_actor_t::message_type) {
-        self.on(static_cast<const message::create_actor_t &>(message), context);
-    } else if (message.type_index == message::spawn_actor_t::message_type) {
-        self.on(static_cast<const message::spawn_actor_t &>(message), context);
-    } else if (message.type_index == message::registration_request_t::message_type) {
-        self.on(static_cast<const message::registration_request_t &>(message), context);
-    } else if (message.type_index == message::registration_response_t::message_type) {
-        self.on(static_cast<const message::registration_response_t &>(message), context);
-    } else if (message.type_index == message::deregistration_notify_t::message_type) {
-        self.on(static_cast<const message::deregistration_notify_t &>(message), context);
-    } else if (message.type_index == message::deregistration_service_t::message_type) {
-        self.on(static_cast<const message::deregistration_service_t &>(message), context);
-    } else if (message.type_index == message::discovery_request_t::message_type) {
-        self.on(static_cast<const message::discovery_request_t &>(message), context);
-    } else if (message.type_index == message::discovery_response_t::message_type) {
-        self.on(static_cast<const message::discovery_response_t &>(message), context);
-    } else if (message.type_index == message::discovery_promise_t::message_type) {
-        self.on(static_cast<const message::discovery_promise_t &>(message), context);
-    } else if (message.type_index == message::discovery_future_t::message_type) {
-        self.on(static_cast<const message::discovery_future_t &>(message), context);
-    } else if (message.type_index == message::discovery_cancel_t::message_type) {
-        self.on(static_cast<const message::discovery_cancel_t &>(message), context);
-    } else if (message.type_index == message::link_request_t::message_type) {
-        self.on(static_cast<const message::link_request_t &>(message), context);
-    } else if (message.type_index == message::link_response_t::message_type) {
-        self.on(static_cast<const message::link_response_t &>(message), context);
-    } else if (message.type_index == message::unlink_notify_t::message_type) {
-        self.on(static_cast<const message::unlink_notify_t &>(message), context);
-    } else if (message.type_index == message::unlink_request_t::message_type) {
-        self.on(static_cast<const message::unlink_request_t &>(message), context);
-    } else if (message.type_index == message::unlink_response_t::message_type) {
-        self.on(static_cast<const message::unlink_response_t &>(message), context);
-    } else {
+    auto &visitors = get_visitors();
+    auto id = message.type_id;
+    if (id >= visitors.size() || !visitors[id]) {
         return false;
     }
+    visitors[id](const_cast<default_stringifier_t &>(*this), message, context);
     return true;
 }
 
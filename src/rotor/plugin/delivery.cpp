@@ -11,6 +11,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <sstream>
+#include <vector>
 
 using namespace rotor;
 using namespace rotor::plugin;
@@ -34,6 +35,38 @@ void delivery_plugin_base_t::activate(actor_base_t *actor_) noexcept {
     subscription_map->access<to::main_address>() = address;
     sup->delivery = this;
     stringifier = &actor->get_supervisor().access<to::context>()->get_stringifier();
+    pool = sup->message_pool.get();
+    trace_sink = &sup->trace_sink;
+    trace_filter = &sup->trace_filter;
+    stats = &sup->delivery_stats;
+    if (auto var = std::getenv("ROTOR_INSPECT_DELIVERY"); var) {
+        inspection_threshold = atoi(var);
+    }
+}
+
+void delivery_plugin_base_t::enqueue_outbound(message_ptr_t message) noexcept {
+    auto dest = &message->address->supervisor;
+    for (auto &batch : outbound) {
+        if (batch.supervisor == dest) {
+            batch.messages.push_back(std::move(message));
+            return;
+        }
+    }
+    outbound.emplace_back(outbound_batch_t{dest, messages_queue_t{}});
+    outbound.back().messages.push_back(std::move(message));
+}
+
+void delivery_plugin_base_t::flush_outbound() noexcept {
+    static constexpr std::size_t max_batches = 8;
+    for (auto &batch : outbound) {
+        if (!batch.messages.empty()) {
+            batch.supervisor->enqueue_batch(batch.messages);
+        }
+    }
+    // drop batches (and their storage) of (possibly gone) rare destinations
+    if (outbound.size() > max_batches) {
+        outbound.clear();
+    }
 }
 
 void local_delivery_t::delivery(message_ptr_t &message,
@@ -41,95 +74,93 @@ void local_delivery_t::delivery(message_ptr_t &message,
     for (auto &handler : local_recipients.external) {
         auto &sup = handler->actor_ptr->get_supervisor();
         auto &address = sup.get_address();
-        auto wrapped_message = make_message<payload::handler_call_t>(address, message, handler);
+        auto wrapped_message = make_pooled_message<payload::handler_call_t>(message_pool_t::current(), address, message,
+                                                                            handler);
         sup.enqueue(std::move(wrapped_message));
     }
     for (auto &handler : local_recipients.internal) {
-        handler->call(message);
+        handler->dispatch(message);
     }
 }
 
-static int get_message_level(const message_base_t *message) noexcept {
-    auto type = message->type_index;
-    if (type == message::unsubscription_t::message_type) {
-        return 9;
-    } else if (type == message::subscription_t::message_type) {
-        return 9;
-    } else if (type == message::unsubscription_external_t::message_type) {
-        return 9;
-    } else if (type == message::external_subscription_t::message_type) {
-        return 9;
-    } else if (type == message::commit_unsubscription_t::message_type) {
-        return 9;
-    } else if (type == message::deregistration_service_t::message_type) {
-        return 2;
-    } else if (type == message::registration_request_t::message_type) {
-        return 2;
-    } else if (type == message::registration_response_t::message_type) {
-        return 2;
-    } else if (type == message::discovery_request_t::message_type) {
-        return 2;
-    } else if (type == message::discovery_response_t::message_type) {
-        return 2;
-    } else if (type == message::discovery_promise_t::message_type) {
-        return 2;
-    } else if (type == message::discovery_future_t::message_type) {
-        return 2;
-    } else if (type == message::discovery_cancel_t::message_type) {
-        return 2;
-    } else if (type == message::link_request_t::message_type) {
-        return 5;
-    } else if (type == message::link_response_t::message_type) {
-        return 3;
-    } else if (type == message::shutdown_trigger_t::message_type) {
-        return 1;
-    } else if (type == message::handler_call_t::message_type) {
-        return 20;
-    } else if (type == message::init_request_t::message_type) {
-        return 11;
-    } else if (type == message::init_response_t::message_type) {
-        return 11;
-    } else if (type == message::start_trigger_t::message_type) {
-        return 10;
-    } else if (type == message::shutdown_request_t::message_type) {
-        return 15;
-    } else if (type == message::shutdown_response_t::message_type) {
-        return 15;
-    } else if (type == message::create_actor_t::message_type) {
-        return 7;
-    } else if (type == message::spawn_actor_t::message_type) {
-        return 7;
-    } else if (type == message::deregistration_notify_t::message_type) {
-        return 3;
-    } else if (type == message::unlink_notify_t::message_type) {
-        return 8;
-    } else if (type == message::unlink_request_t::message_type) {
-        return 8;
-    } else if (type == message::unlink_response_t::message_type) {
-        return 8;
+namespace {
+using levels_t = std::vector<int>;
+
+struct level_t {
+    message_type_id_t type_id;
+    int level;
+};
+
+levels_t make_levels(std::initializer_list<level_t> items) noexcept {
+    levels_t levels;
+    for (auto &item : items) {
+        if (item.type_id >= levels.size()) {
+            levels.resize(item.type_id + 1, 0);
+        }
+        levels[item.type_id] = item.level;
     }
-    return 0;
+    return levels;
 }
 
-static void dump_message(const char *prefix, const message_ptr_t &message,
-                         const message_stringifier_t *stringifier) noexcept {
-    auto var = std::getenv("ROTOR_INSPECT_DELIVERY");
-    if (var) {
-        int threshold = atoi(var);
-        auto level = get_message_level(message.get());
+const levels_t &get_levels() noexcept {
+    static const levels_t levels = make_levels({
+        {message::unsubscription_t::message_type_id, 9},
+        {message::subscription_t::message_type_id, 9},
+        {message::unsubscription_external_t::message_type_id, 9},
+        {message::external_subscription_t::message_type_id, 9},
+        {message::commit_unsubscription_t::message_type_id, 9},
+        {message::deregistration_service_t::message_type_id, 2},
+        {message::registration_request_t::message_type_id, 2},
+        {message::registration_response_t::message_type_id, 2},
+        {message::discovery_request_t::message_type_id, 2},
+        {message::discovery_response_t::message_type_id, 2},
+        {message::discovery_promise_t::message_type_id, 2},
+        {message::discovery_future_t::message_type_id, 2},
+        {message::discovery_cancel_t::message_type_id, 2},
+        {message::link_request_t::message_type_id, 5},
+        {message::link_response_t::message_type_id, 3},
+        {message::shutdown_trigger_t::message_type_id, 1},
+        {message::handler_call_t::message_type_id, 20},
+        {message::init_request_t::message_type_id, 11},
+        {message::init_response_t::message_type_id, 11},
+        {message::start_trigger_t::message_type_id, 10},
+        {message::shutdown_request_t::message_type_id, 15},
+        {message::shutdown_response_t::message_type_id, 15},
+        {message::create_actor_t::message_type_id, 7},
+        {message::spawn_actor_t::message_type_id, 7},
+        {message::deregistration_notify_t::message_type_id, 3},
+        {message::unlink_notify_t::message_type_id, 8},
+        {message::unlink_request_t::message_type_id, 8},
+        {message::unlink_response_t::message_type_id, 8},
+    });
+    return levels;
+}
+
+void dump_message(const char *prefix, const message_ptr_t &message, const message_stringifier_t *stringifier,
+                  int threshold) noexcept {
+    if (threshold >= 0) {
+        auto level = inspected_local_delivery_t::get_level(*message);
         if (level <= threshold) {
             std::cout << prefix << "{" << level << "} " << stringifier->stringify(*message) << "\n";
         }
     }
 }
+} // namespace
+
+int inspected_local_delivery_t::get_level(const message_base_t &message) noexcept {
+    auto &levels = get_levels();
+    auto id = message.type_id;
+    return id < levels.size() ? levels[id] : 0;
+}
 
 void inspected_local_delivery_t::delivery(message_ptr_t &message,
                                           const subscription_t::joint_handlers_t &local_recipients,
-                                          const message_stringifier_t *stringifier) noexcept {
-    dump_message(">> ", message, stringifier);
+                                          const message_stringifier_t *stringifier, int threshold) noexcept {
+    dump_message(">> ", message, stringifier, threshold);
     local_delivery_t::delivery(message, local_recipients);
 }
 
-void inspected_local_delivery_t::discard(message_ptr_t &message, const message_stringifier_t *stringifier) noexcept {
-    dump_message("<DISCARDED> ", message, stringifier);
+void inspected_local_delivery_t::discard(message_ptr_t &message, const message_stringifier_t *stringifier,
+                                         int threshold) noexcept {
+    dump_message("<DISCARDED> ", message, stringifier, threshold);
 }
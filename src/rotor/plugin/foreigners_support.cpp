@@ -13,7 +13,6 @@ using namespace rotor::plugin;
 namespace {
 namespace to {
 struct lifetime {};
-struct points {};
 struct state {};
 struct alive_actors {};
 } // namespace to
@@ -21,7 +20,6 @@ struct alive_actors {};
 
 template <> auto &supervisor_t::access<to::alive_actors>() noexcept { return alive_actors; }
 template <> auto &actor_base_t::access<to::lifetime>() noexcept { return lifetime; }
-template <> auto &lifetime_plugin_t::access<to::points>() noexcept { return points; }
 template <> auto &actor_base_t::access<to::state>() noexcept { return state; }
 
 const std::type_index foreigners_support_plugin_t::class_identity = typeid(foreigners_support_plugin_t);
@@ -58,13 +56,9 @@ void foreigners_support_plugin_t::on_call(message::handler_call_t &message) noex
     if (sup.access<to::alive_actors>().count(child_actor)) {
         if (child_actor->access<to::state>() < state_t::SHUT_DOWN) {
             auto &orig_message = message.payload.orig_message;
-            auto point = subscription_point_t(handler, orig_message->address);
             auto lifetime = child_actor->access<to::lifetime>();
-            if (lifetime) {
-                auto &points = lifetime->access<to::points>();
-                if (points.find(point) != points.end()) {
-                    handler->call(orig_message);
-                }
+            if (lifetime && lifetime->is_subscribed(*handler, *orig_message->address)) {
+                handler->dispatch(orig_message);
             }
         }
     }
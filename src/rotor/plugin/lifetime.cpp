@@ -6,6 +6,7 @@
 
 #include "rotor/plugin/lifetime.h"
 #include "rotor/supervisor.h"
+#include <cassert>
 
 using namespace rotor;
 using namespace rotor::plugin;
@@ -86,7 +87,7 @@ void lifetime_plugin_t::unsubscribe() noexcept {
             unsubscribe(info);
             ++rit;
         } else {
-            auto it = points.erase(--rit.base());
+            auto it = erase(--rit.base());
             rit = std::reverse_iterator(it);
         }
     }
@@ -107,6 +108,24 @@ void lifetime_plugin_t::on_unsubscription_external(message::unsubscription_exter
 
 void lifetime_plugin_t::initate_subscription(const subscription_info_ptr_t &info) noexcept {
     points.emplace_back(info);
+    points_index.emplace(make_key(*info->handler, *info->address));
+}
+
+bool lifetime_plugin_t::is_subscribed(const handler_base_t &handler, const address_t &address) const noexcept {
+    return points_index.count(make_key(handler, address));
+}
+
+auto lifetime_plugin_t::make_key(const handler_base_t &handler, const address_t &address) noexcept -> point_key_t {
+    auto hash = reinterpret_cast<std::size_t>(handler.handler_type) ^ address.hash;
+    return point_key_t{handler.handler_type, &address, hash};
+}
+
+auto lifetime_plugin_t::erase(subscription_container_t::iterator it) noexcept -> subscription_container_t::iterator {
+    auto &info = *it;
+    auto index_it = points_index.find(make_key(*info->handler, *info->address));
+    assert(index_it != points_index.end());
+    points_index.erase(index_it);
+    return points.erase(it);
 }
 
 bool lifetime_plugin_t::handle_unsubscription(const subscription_point_t &point, bool external) noexcept {
@@ -116,7 +135,7 @@ bool lifetime_plugin_t::handle_unsubscription(const subscription_point_t &point,
     if (point.owner_tag != owner_tag_t::PLUGIN) {
         auto it = points.find(point);
         plugin_base_t::forget_subscription(*it);
-        points.erase(it);
+        erase(it);
         result = true;
         if (points.empty()) {
             plugin_base_t::deactivate();
@@ -16,6 +16,8 @@ struct parent {};
 struct locality_leader {};
 struct inbound_queue {};
 struct inbound_queue_size {};
+struct pool_messages {};
+struct message_pool {};
 } // namespace to
 } // namespace
 
@@ -23,6 +25,8 @@ template <> auto &supervisor_t::access<to::parent>() noexcept { return parent; }
 template <> auto &supervisor_t::access<to::locality_leader>() noexcept { return locality_leader; }
 template <> auto &supervisor_t::access<to::inbound_queue>() noexcept { return inbound_queue; }
 template <> auto &supervisor_t::access<to::inbound_queue_size>() noexcept { return inbound_queue_size; }
+template <> auto &supervisor_t::access<to::pool_messages>() noexcept { return pool_messages; }
+template <> auto &supervisor_t::access<to::message_pool>() noexcept { return message_pool; }
 
 const std::type_index locality_plugin_t::class_identity = typeid(locality_plugin_t);
 
@@ -38,6 +42,11 @@ void locality_plugin_t::activate(actor_base_t *actor_) noexcept {
     if (!use_other) {
         auto sz = sup.access<to::inbound_queue_size>();
         sup.access<to::inbound_queue>().reserve_unsafe(sz);
+        if (sup.access<to::pool_messages>()) {
+            sup.access<to::message_pool>().reset(new message_pool_t());
+        }
+    } else {
+        sup.access<to::message_pool>() = locality_leader->access<to::message_pool>();
     }
     return plugin_base_t::activate(actor_);
 }
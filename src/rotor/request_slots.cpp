@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/request_slots.h"
+#include <cassert>
+#include <exception>
+
+using namespace rotor;
+
+request_slots_t::request_slots_t() noexcept : free_slots{nullptr}, capacity{0}, occupied{0} {}
+
+request_slot_t &request_slots_t::acquire() noexcept {
+    if (!free_slots) {
+        grow();
+    }
+    auto &slot = *free_slots;
+    free_slots = slot.actor_link.next;
+    slot.actor_link.next = nullptr;
+    // free slot keeps its next id, just without request bit
+    slot.timer.request_id |= request_bit;
+    ++occupied;
+    return slot;
+}
+
+void request_slots_t::release(request_slot_t &slot) noexcept {
+    assert(find(slot.timer.request_id) == &slot);
+    auto id = slot.timer.request_id;
+    auto generation = ((id & generation_mask) + (request_id_t{1} << index_bits)) & generation_mask;
+    slot.timer.request_id = generation | (id & index_mask);
+    slot.timer.owner = nullptr;
+    slot.curry = request_curry_t{};
+    slot.actor_link = request_link_t{nullptr, free_slots};
+    slot.bucket_link = request_link_t{};
+    free_slots = &slot;
+    --occupied;
+}
+
+void request_slots_t::grow() noexcept {
+    if (capacity + chunk_size > index_mask + 1) {
+        // the slot index does not fit into request id anymore, i.e. too many pending requests
+        std::terminate();
+    }
+    auto chunk = chunk_t(new request_slot_t[chunk_size]);
+    // link the new slots in the index order
+    for (std::size_t i = chunk_size; i > 0; --i) {
+        auto &slot = chunk[i - 1];
+        slot.timer.request_id = capacity + i - 1;
+        slot.actor_link.next = free_slots;
+        free_slots = &slot;
+    }
+    chunks.emplace_back(std::move(chunk));
+    capacity += chunk_size;
+}
@@ -7,6 +7,8 @@
 #include "rotor/subscription.h"
 #include "rotor/supervisor.h"
 #include "rotor/handler.h"
+#include <algorithm>
+#include <cassert>
 
 using namespace rotor;
 
@@ -20,6 +22,98 @@ struct internal_handler {};
 template <> auto &subscription_info_t::access<to::internal_address>() noexcept { return internal_address; }
 template <> auto &subscription_info_t::access<to::internal_handler>() noexcept { return internal_handler; }
 
+subscription_t::handlers_t::handlers_t(handlers_t &&other) noexcept
+    : count{other.count}, capacity{other.capacity}, local{other.local}, heap{std::move(other.heap)} {
+    other.count = 0;
+    other.capacity = 1;
+}
+
+auto subscription_t::handlers_t::operator=(handlers_t &&other) noexcept -> handlers_t & {
+    count = other.count;
+    capacity = other.capacity;
+    local = other.local;
+    heap = std::move(other.heap);
+    other.count = 0;
+    other.capacity = 1;
+    return *this;
+}
+
+void subscription_t::handlers_t::emplace_back(handler_base_t *handler) noexcept {
+    if (count == capacity) {
+        auto new_capacity = capacity * 2;
+        auto new_heap = heap_t(new handler_base_t *[new_capacity]);
+        std::copy(begin(), end(), new_heap.get());
+        heap = std::move(new_heap);
+        capacity = new_capacity;
+    }
+    data()[count++] = handler;
+}
+
+void subscription_t::handlers_t::erase(iterator it) noexcept {
+    std::copy(it + 1, end(), it);
+    --count;
+}
+
+subscription_t::addressed_handlers_t::addressed_handlers_t() noexcept : mask{0}, occupied{0} {}
+
+auto subscription_t::addressed_handlers_t::try_emplace(const subscription_key_t &key) noexcept -> joint_handlers_t & {
+    if ((occupied + 1) * 2 > slots.size()) {
+        grow();
+    }
+    auto hash = hash_of(key);
+    auto index = hash & mask;
+    while (slots[index].key.address) {
+        auto &slot = slots[index];
+        if (slot.key == key) {
+            return slot.handlers;
+        }
+        index = (index + 1) & mask;
+    }
+    auto &slot = slots[index];
+    slot.key = key;
+    slot.hash = hash;
+    ++occupied;
+    return slot.handlers;
+}
+
+void subscription_t::addressed_handlers_t::erase(const subscription_key_t &key) noexcept {
+    auto index = hash_of(key) & mask;
+    while (!(slots[index].key == key)) {
+        assert(slots[index].key.address && "key is present");
+        index = (index + 1) & mask;
+    }
+    // shift back the following slots of the cluster, which are not at their home index
+    auto hole = index;
+    for (auto next = (hole + 1) & mask; slots[next].key.address; next = (next + 1) & mask) {
+        auto home = slots[next].hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            slots[hole] = std::move(slots[next]);
+            hole = next;
+        }
+    }
+    slots[hole].key = subscription_key_t{nullptr, nullptr};
+    slots[hole].handlers = joint_handlers_t{};
+    --occupied;
+}
+
+void subscription_t::addressed_handlers_t::grow() noexcept {
+    auto old_slots = std::move(slots);
+    auto capacity = std::max<std::size_t>(old_slots.size() * 2, 16);
+    slots = slots_t(capacity);
+    mask = capacity - 1;
+    occupied = 0;
+    for (auto &old_slot : old_slots) {
+        if (old_slot.key.address) {
+            auto index = old_slot.hash & mask;
+            while (slots[index].key.address) {
+                index = (index + 1) & mask;
+            }
+            slots[index] = std::move(old_slot);
+            ++occupied;
+        }
+    }
+}
+
 subscription_t::subscription_t() noexcept : main_address{nullptr} {}
 
 subscription_info_ptr_t subscription_t::materialize(const subscription_point_t &point) noexcept {
@@ -35,10 +129,10 @@ subscription_info_ptr_t subscription_t::materialize(const subscription_point_t &
         auto &info_list = internal_infos[address];
         info_list.emplace_back(info);
 
-        auto insert_result = mine_handlers.try_emplace({address.get(), handler->message_type()});
-        auto &joint_handlers = insert_result.first->second;
+        auto &joint_handlers = mine_handlers.try_emplace({address.get(), handler->message_type()});
         auto &handlers = internal_handler ? joint_handlers.internal : joint_handlers.external;
         handlers.emplace_back(handler.get());
+        update_cache(*address, handler->message_type(), &joint_handlers);
     }
 
     return info;
@@ -50,28 +144,20 @@ void subscription_t::update(subscription_point_t &point, handler_ptr_t &new_hand
     bool internal_address = address->same_locality(*main_address);
     bool internal_handler = handler->actor_ptr->get_address()->same_locality(*main_address);
     if (internal_address) {
-        auto it = mine_handlers.find({address.get(), handler->message_type()});
-        assert(it != mine_handlers.end());
-        auto &joint_handlers = it->second;
+        auto joint_handlers_ptr = mine_handlers.find({address.get(), handler->message_type()});
+        assert(joint_handlers_ptr);
+        auto &joint_handlers = *joint_handlers_ptr;
         auto &handlers = internal_handler ? joint_handlers.internal : joint_handlers.external;
         auto it_handler = std::find(handlers.begin(), handlers.end(), handler.get());
         assert(it_handler != handlers.end());
         *it_handler = new_handler.get();
+        if (address->cached_handler == handler.get()) {
+            address->cached_handler = new_handler.get();
+        }
     }
     point.handler = new_handler;
 }
 
-const subscription_t::joint_handlers_t *subscription_t::get_recipients(const message_base_t &message) const noexcept {
-    auto address = message.address.get();
-    auto message_type = message.type_index;
-    auto key = subscription_key_t{address, message_type};
-    auto it = mine_handlers.find(key);
-    if (it != mine_handlers.end()) {
-        return &it->second;
-    }
-    return nullptr;
-}
-
 void subscription_t::forget(const subscription_info_ptr_t &info) noexcept {
     if (!info->access<to::internal_address>())
         return;
@@ -89,8 +175,8 @@ void subscription_t::forget(const subscription_info_ptr_t &info) noexcept {
     }
 
     auto handler_ptr = info->handler.get();
-    auto it = mine_handlers.find({info->address.get(), handler_ptr->message_type()});
-    auto &joint_handlers = it->second;
+    auto key = subscription_key_t{info->address.get(), handler_ptr->message_type()};
+    auto &joint_handlers = *mine_handlers.find(key);
     auto internal_handler = info->access<to::internal_handler>();
     auto &handlers = internal_handler ? joint_handlers.internal : joint_handlers.external;
     auto &misc_handlers = !internal_handler ? joint_handlers.internal : joint_handlers.external;
@@ -99,6 +185,18 @@ void subscription_t::forget(const subscription_info_ptr_t &info) noexcept {
     assert(handler_it != handlers.end());
     handlers.erase(handler_it);
     if (handlers.empty() && misc_handlers.empty()) {
-        mine_handlers.erase(it);
+        mine_handlers.erase(key);
+        update_cache(*key.address, key.message_type, nullptr);
+    } else {
+        update_cache(*key.address, key.message_type, &joint_handlers);
+    }
+}
+
+void subscription_t::update_cache(address_t &address, message_type_t message_type,
+                                  const joint_handlers_t *handlers) noexcept {
+    auto single = handlers && handlers->internal.size() == 1 && handlers->external.empty();
+    if (address.cached_type == message_type || (!address.cached_type && single)) {
+        address.cached_type = single ? message_type : nullptr;
+        address.cached_handler = single ? *handlers->internal.begin() : nullptr;
     }
 }
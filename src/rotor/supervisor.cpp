@@ -7,6 +7,7 @@
 #include "rotor/supervisor.h"
 #include "rotor/registry.h"
 #include <cassert>
+#include <chrono>
 
 using namespace rotor;
 
@@ -23,18 +24,22 @@ template <> auto &subscription_info_t::access<to::internal_address>() noexcept {
 template <> auto &subscription_info_t::access<to::internal_handler>() noexcept { return internal_handler; }
 
 supervisor_t::supervisor_t(supervisor_config_t &config)
-    : actor_base_t(config), last_req_id{0}, parent{config.supervisor}, inbound_queue(0),
-      inbound_queue_size{config.inbound_queue_size}, poll_duration{config.poll_duration},
+    : actor_base_t(config), last_req_id{0}, parent{config.supervisor},
+      inbound_queue(config.intrusive_inbound_queue), inbound_queue_size{config.inbound_queue_size},
+      poll_duration{config.poll_duration}, pool_messages{config.pool_messages},
+      timeout_granularity{config.timeout_granularity}, pin_addresses{config.pin_addresses},
       shutdown_flag{config.shutdown_flag}, shutdown_poll_frequency{config.shutdown_poll_frequency},
       create_registry(config.create_registry), synchronize_start(config.synchronize_start),
       registry_address(config.registry_address), policy{config.policy} {
     supervisor = this;
+    inbound_queue.stats = &delivery_stats;
 }
 
-supervisor_t::~supervisor_t() {
-    message_base_t *ptr;
-    while (inbound_queue.pop(ptr)) {
-        intrusive_ptr_release(ptr);
+supervisor_t::~supervisor_t() {}
+
+void supervisor_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    while (!messages.empty()) {
+        enqueue(messages.take_front());
     }
 }
 
@@ -47,7 +52,13 @@ address_ptr_t supervisor_t::make_address() noexcept {
 }
 
 address_ptr_t supervisor_t::instantiate_address(const void *locality) noexcept {
-    return new address_t{*this, locality};
+    if (!pin_addresses) {
+        return new address_t{*this, locality};
+    }
+    auto address = new address_t{*this, locality, true};
+    std::lock_guard<std::mutex> lock(context->pinned_mutex);
+    context->pinned_addresses.emplace_back(address);
+    return address;
 }
 
 void supervisor_t::do_initialize(system_context_t *ctx) noexcept {
@@ -118,34 +129,102 @@ void supervisor_t::on_child_shutdown(actor_base_t *) noexcept {
 
 void supervisor_t::intercept(message_ptr_t &, const void *, const continuation_t &cont) noexcept { cont(); }
 
+void request_timer_t::trigger(bool cancelled) noexcept {
+    static_cast<supervisor_t *>(owner)->on_request_trigger(request_id, cancelled);
+}
+
 void supervisor_t::on_request_trigger(request_id_t timer_id, bool cancelled) noexcept {
-    auto it = request_map.find(timer_id);
-    if (it != request_map.end()) {
-        auto &request_curry = it->second;
+    auto &slots = locality_leader->request_slots;
+    auto slot = slots.find(timer_id);
+    if (slot) {
+        auto &request_curry = slot->curry;
         auto &actor = *request_curry.source;
+        auto continuation = request_curry.continuation;
+        message_ptr_t timeout_message;
         if (!cancelled) {
             message_ptr_t &request = request_curry.request_message;
             auto ec = make_error_code(error_code_t::request_timeout);
             auto &source = actor.access<to::identity>();
             auto reason = ::make_error(source, ec, {}, request);
-            auto timeout_message = request_curry.fn(request_curry.origin, *request, reason);
+            timeout_message = request_curry.fn(request_curry.origin, *request, reason);
+        }
+        actor.active_requests.remove(*slot);
+        slots.release(*slot);
+        if (continuation) {
+            // the slot is already released, i.e. the continuation might make new requests
+            if (timeout_message) {
+                continuation->resume(std::move(timeout_message));
+            } else {
+                continuation->abandon();
+            }
+        } else if (timeout_message) {
             put(std::move(timeout_message));
         }
-        auto ait = actor.active_requests.find(timer_id);
-        actor.active_requests.erase(ait);
-        request_map.erase(it);
     }
 }
 
 void supervisor_t::discard_request(request_id_t request_id) noexcept {
-    assert(request_map.find(request_id) != request_map.end());
-    cancel_timer(request_id);
-    request_map.erase(request_id);
+    assert(locality_leader->request_slots.find(request_id));
+    cancel_request_timer(request_id);
+}
+
+supervisor_t::clock_t::time_point supervisor_t::now() noexcept { return clock_t::now(); }
+
+std::int64_t supervisor_t::start_coarse_timer(request_slot_t &slot, const pt::time_duration &timeout) noexcept {
+    using namespace std::chrono;
+    auto now = duration_cast<microseconds>(this->now().time_since_epoch()).count();
+    auto granularity = timeout_granularity.total_microseconds();
+    auto deadline = (now + timeout.total_microseconds() + granularity - 1) / granularity;
+    auto &bucket = timeout_buckets[deadline];
+    if (bucket.requests.empty() && !bucket.expired) {
+        auto interval = pt::microseconds{deadline * granularity - now};
+        auto on_timer = [deadline](supervisor_t *sup, request_id_t timer_id, bool cancelled) noexcept {
+            sup->on_coarse_timer(deadline, timer_id, cancelled);
+        };
+        bucket.timer_id = start_timer(interval, *this, std::move(on_timer));
+    }
+    bucket.requests.push(slot);
+    return deadline;
+}
+
+void supervisor_t::cancel_request_timer(request_id_t request_id) noexcept {
+    auto slot = locality_leader->request_slots.find(request_id);
+    assert(slot);
+    if (timeout_granularity.is_zero()) {
+        return do_cancel_timer(slot->timer);
+    }
+    auto bucket_it = timeout_buckets.find(slot->curry.timeout_bucket);
+    assert(bucket_it != timeout_buckets.end());
+    auto &bucket = bucket_it->second;
+    bucket.requests.remove(*slot);
+    if (bucket.requests.empty() && !bucket.expired) {
+        auto timer_id = bucket.timer_id;
+        timeout_buckets.erase(bucket_it);
+        cancel_timer(timer_id);
+    }
+    on_request_trigger(request_id, true);
+}
+
+void supervisor_t::on_coarse_timer(std::int64_t deadline, request_id_t timer_id, bool cancelled) noexcept {
+    auto it = timeout_buckets.find(deadline);
+    if (it == timeout_buckets.end() || it->second.timer_id != timer_id || it->second.expired) {
+        return;
+    }
+    // the expired bucket is erased only here, i.e. the requests can be
+    // safely discarded (or added) while the bucket is being drained
+    auto &bucket = it->second;
+    bucket.expired = true;
+    while (!bucket.requests.empty()) {
+        auto &slot = bucket.requests.first();
+        bucket.requests.remove(slot);
+        on_request_trigger(slot.timer.request_id, cancelled);
+    }
+    timeout_buckets.erase(it);
 }
 
 void supervisor_t::shutdown_finish() noexcept {
     actor_base_t::shutdown_finish();
-    assert(request_map.size() == 0);
+    assert(locality_leader != this || request_slots.empty());
 }
 
 spawner_t supervisor_t::spawn(factory_t factory) noexcept { return spawner_t(std::move(factory), *this); }
@@ -165,7 +244,5 @@ void supervisor_t::on_shutdown_check_timer(request_id_t, bool cancelled) noexcep
 void supervisor_t::uplift_last_message() noexcept {
     auto &q = locality_leader->queue;
     assert(!q.empty());
-    auto message = message_ptr_t(q.back().detach(), false);
-    q.push_front(std::move(message));
-    q.pop_back();
+    q.push_front(q.take_back());
 }
@@ -49,6 +49,10 @@ system_context_t::~system_context_t() {
     }
 }
 
+delivery_counters_t system_context_t::get_delivery_stats() const noexcept {
+    return supervisor ? supervisor->get_delivery_stats() : delivery_counters_t{};
+}
+
 auto system_context_t::get_stringifier() -> const message_stringifier_t & {
     if (!stringifier) {
         stringifier = make_stringifier();
@@ -25,8 +25,15 @@ void supervisor_thread_t::shutdown() noexcept {
 void supervisor_thread_t::enqueue(message_ptr_t message) noexcept {
     auto ctx = static_cast<system_context_thread_t *>(context);
     inbound_queue.push(message.detach());
-    std::lock_guard<std::mutex> lock(ctx->mutex);
-    ctx->cv.notify_one();
+    ctx->wake_up();
+}
+
+void supervisor_thread_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    auto ctx = static_cast<system_context_thread_t *>(context);
+    while (!messages.empty()) {
+        inbound_queue.push(messages.take_front().detach());
+    }
+    ctx->wake_up();
 }
 
 void supervisor_thread_t::intercept(message_ptr_t &message, const void *tag,
@@ -48,9 +55,14 @@ void supervisor_thread_t::do_start_timer(const pt::time_duration &interval, time
     ctx->start_timer(interval, handler);
 }
 
-void supervisor_thread_t::do_cancel_timer(request_id_t timer_id) noexcept {
+void supervisor_thread_t::do_cancel_timer(timer_handler_base_t &handler) noexcept {
+    auto ctx = static_cast<system_context_thread_t *>(context);
+    ctx->cancel_timer(handler);
+}
+
+supervisor_thread_t::clock_t::time_point supervisor_thread_t::now() noexcept {
     auto ctx = static_cast<system_context_thread_t *>(context);
-    ctx->cancel_timer(timer_id);
+    return ctx->now;
 }
 
 void supervisor_thread_t::update_time() noexcept {
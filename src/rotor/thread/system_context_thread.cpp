@@ -33,7 +33,7 @@ inline auto rotor::actor_base_t::access<to::on_timer_trigger, request_id_t, bool
 
 using time_units_t = std::chrono::microseconds;
 
-system_context_thread_t::system_context_thread_t() noexcept { update_time(); }
+system_context_thread_t::system_context_thread_t() noexcept : timers{clock_t::now()} { update_time(); }
 
 void system_context_thread_t::run() noexcept {
     using std::chrono::duration_cast;
@@ -57,10 +57,7 @@ void system_context_thread_t::run() noexcept {
         if (condition()) {
             try_pop_inbound();
             if (total_us && queue.empty()) {
-                auto dealine = clock_t::now() + delta;
-                if (!timer_nodes.empty()) {
-                    dealine = std::min(dealine, timer_nodes.front().deadline);
-                }
+                auto dealine = std::min(clock_t::now() + delta, timers.next_deadline());
                 // fast stage, indirect spin-lock, cpu consuming
                 while (queue.empty() && (clock_t::now() < dealine)) {
                     try_pop_inbound();
@@ -71,8 +68,12 @@ void system_context_thread_t::run() noexcept {
                 std::unique_lock<std::mutex> lock(mutex);
                 auto predicate = [&]() { return !inbound.empty(); };
                 // wait notification, do not consume CPU
-                auto deadline = !timer_nodes.empty() ? timer_nodes.front().deadline : clock_t::now() + 1min;
+                auto deadline = std::min(clock_t::now() + 1min, timers.next_deadline());
+                // pairs with the fence in wake_up(): either producer sees the flag or we see its message
+                sleeping.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
                 cv.wait_until(lock, deadline, predicate);
+                sleeping.store(false, std::memory_order_relaxed);
             }
             update_time();
         }
@@ -80,6 +81,14 @@ void system_context_thread_t::run() noexcept {
     root_sup.do_process();
 }
 
+void system_context_thread_t::wake_up() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+    }
+}
+
 void system_context_thread_t::check() noexcept {
     auto &root_sup = *get_supervisor();
     auto &queue = root_sup.access<to::queue>();
@@ -93,11 +102,9 @@ void system_context_thread_t::check() noexcept {
 
 void system_context_thread_t::update_time() noexcept {
     now = clock_t::now();
-    auto it = timer_nodes.begin();
-    while (it != timer_nodes.end() && it->deadline < now) {
-        auto actor_ptr = it->handler->owner;
-        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(it->handler->request_id, false);
-        it = timer_nodes.erase(it);
+    while (auto handler = timers.pop_expired(now)) {
+        auto actor_ptr = handler->owner;
+        actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler->request_id, false);
     }
 }
 
@@ -105,24 +112,17 @@ void system_context_thread_t::start_timer(const pt::time_duration &interval, tim
     if (intercepting)
         update_time();
     auto deadline = now + time_units_t{interval.total_microseconds()};
-    auto it = timer_nodes.begin();
-    for (; it != timer_nodes.end(); ++it) {
-        if (deadline < it->deadline) {
-            break;
-        }
-    }
-    timer_nodes.insert(it, deadline_info_t{&handler, deadline});
+    timers.start(handler, deadline);
 }
 
-void system_context_thread_t::cancel_timer(request_id_t timer_id) noexcept {
+void system_context_thread_t::cancel_timer(timer_handler_base_t &handler) noexcept {
     if (intercepting)
         update_time();
-    auto predicate = [&](auto &info) { return info.handler->request_id == timer_id; };
-    auto it = std::find_if(timer_nodes.begin(), timer_nodes.end(), predicate);
-    assert(it != timer_nodes.end() && "timer has been found");
-    auto &actor_ptr = it->handler->owner;
-    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(timer_id, true);
-    timer_nodes.erase(it);
+    auto found = timers.cancel(handler);
+    assert(found && "timer has been found");
+    (void)found;
+    auto actor_ptr = handler.owner;
+    actor_ptr->access<to::on_timer_trigger, request_id_t, bool>(handler.request_id, true);
 }
 
 } // namespace rotor
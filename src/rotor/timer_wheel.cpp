@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/timer_wheel.h"
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace rotor;
+
+static inline unsigned lowest_bit(std::uint64_t value) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+}
+
+/* returns the bits of the level, which are strictly greater than the digit */
+static inline std::uint64_t bits_after(std::uint64_t bits, std::uint64_t digit) noexcept {
+    return digit + 1 < timer_wheel_t::slots ? bits & (~std::uint64_t{0} << (digit + 1)) : 0;
+}
+
+timer_wheel_t::timer_wheel_t(const clock_t::time_point &origin_) noexcept : origin{origin_}, current{0}, pending{0} {
+    heads.fill(nullptr);
+    tails.fill(nullptr);
+    occupied.fill(0);
+}
+
+void timer_wheel_t::start(timer_handler_base_t &handler, const clock_t::time_point &deadline) noexcept {
+    assert(handler.wheel_link.slot == timer_link_t::detached && "timer is not pending");
+    handler.wheel_link.expiry = std::max(to_tick(deadline, true), current + 1);
+    place(handler);
+    ++pending;
+}
+
+bool timer_wheel_t::cancel(timer_handler_base_t &handler) noexcept {
+    if (handler.wheel_link.slot == timer_link_t::detached) {
+        return false;
+    }
+    unlink(handler);
+    --pending;
+    return true;
+}
+
+timer_handler_base_t *timer_wheel_t::pop_expired(const clock_t::time_point &now) noexcept {
+    if (!heads[expired_slot]) {
+        advance(to_tick(now, false));
+    }
+    auto node = heads[expired_slot];
+    if (!node) {
+        return nullptr;
+    }
+    unlink(*node);
+    --pending;
+    return node;
+}
+
+auto timer_wheel_t::next_deadline() const noexcept -> clock_t::time_point {
+    if (heads[expired_slot]) {
+        return origin + tick_t(current);
+    }
+    for (unsigned level = 0; level < levels; ++level) {
+        auto shift = slot_bits * level;
+        auto bits = bits_after(occupied[level], (current >> shift) & (slots - 1));
+        if (bits) {
+            auto block = (current >> (shift + slot_bits)) << (shift + slot_bits);
+            auto tick = block | (std::uint64_t{lowest_bit(bits)} << shift);
+            return origin + tick_t(tick);
+        }
+    }
+    if (heads[overflow_slot]) {
+        auto shift = slot_bits * levels;
+        auto tick = ((current >> shift) + 1) << shift;
+        return origin + tick_t(tick);
+    }
+    return clock_t::time_point::max();
+}
+
+std::uint64_t timer_wheel_t::to_tick(const clock_t::time_point &time_point, bool round_up) const noexcept {
+    if (time_point <= origin) {
+        return 0;
+    }
+    auto delta = time_point - origin;
+    auto ticks = std::chrono::duration_cast<tick_t>(delta);
+    auto value = static_cast<std::uint64_t>(ticks.count());
+    if (round_up && ticks < delta) {
+        ++value;
+    }
+    return value;
+}
+
+void timer_wheel_t::place(node_t &node) noexcept {
+    auto expiry = node.wheel_link.expiry;
+    for (unsigned level = 0; level < levels; ++level) {
+        auto shift = slot_bits * level;
+        if ((expiry >> (shift + slot_bits)) == (current >> (shift + slot_bits))) {
+            auto digit = static_cast<unsigned>((expiry >> shift) & (slots - 1));
+            return link(node, level * slots + digit);
+        }
+    }
+    link(node, overflow_slot);
+}
+
+void timer_wheel_t::link(node_t &node, unsigned slot) noexcept {
+    auto &link = node.wheel_link;
+    link.slot = slot;
+    link.next = nullptr;
+    link.prev = tails[slot];
+    if (link.prev) {
+        link.prev->wheel_link.next = &node;
+    } else {
+        heads[slot] = &node;
+    }
+    tails[slot] = &node;
+    if (slot < overflow_slot) {
+        occupied[slot / slots] |= std::uint64_t{1} << (slot % slots);
+    }
+}
+
+void timer_wheel_t::unlink(node_t &node) noexcept {
+    auto &link = node.wheel_link;
+    auto slot = link.slot;
+    if (link.prev) {
+        link.prev->wheel_link.next = link.next;
+    } else {
+        heads[slot] = link.next;
+    }
+    if (link.next) {
+        link.next->wheel_link.prev = link.prev;
+    } else {
+        tails[slot] = link.prev;
+    }
+    link.prev = link.next = nullptr;
+    link.slot = timer_link_t::detached;
+    if (!heads[slot] && slot < overflow_slot) {
+        occupied[slot / slots] &= ~(std::uint64_t{1} << (slot % slots));
+    }
+}
+
+void timer_wheel_t::reinsert(unsigned slot) noexcept {
+    auto node = heads[slot];
+    heads[slot] = tails[slot] = nullptr;
+    if (slot < overflow_slot) {
+        occupied[slot / slots] &= ~(std::uint64_t{1} << (slot % slots));
+    }
+    while (node) {
+        auto next = node->wheel_link.next;
+        if (slot < slots) {
+            link(*node, expired_slot);
+        } else {
+            place(*node);
+        }
+        node = next;
+    }
+}
+
+void timer_wheel_t::advance(std::uint64_t target) noexcept {
+    while (current < target) {
+        // expire level 0 slots up to the target or to the end of the current block
+        auto limit = std::min(target, current | (slots - 1));
+        auto bits = bits_after(occupied[0], current & (slots - 1));
+        auto limit_digit = limit & (slots - 1);
+        if (limit_digit + 1 < slots) {
+            bits &= ~(~std::uint64_t{0} << (limit_digit + 1));
+        }
+        while (bits) {
+            reinsert(lowest_bit(bits));
+            bits &= bits - 1;
+        }
+        current = limit;
+        if (current == target) {
+            break;
+        }
+
+        // step into the next block, cascading the timers from the higher levels
+        ++current;
+        if ((current & ((std::uint64_t{1} << (slot_bits * levels)) - 1)) == 0) {
+            reinsert(overflow_slot);
+        }
+        unsigned level = 1;
+        while (level + 1 < levels && (current & ((std::uint64_t{1} << (slot_bits * (level + 1))) - 1)) == 0) {
+            ++level;
+        }
+        for (; level > 0; --level) {
+            auto shift = slot_bits * level;
+            if ((current & ((std::uint64_t{1} << shift) - 1)) == 0) {
+                reinsert(level * slots + static_cast<unsigned>((current >> shift) & (slots - 1)));
+            }
+        }
+        reinsert(static_cast<unsigned>(current & (slots - 1)));
+    }
+}
@@ -6,6 +6,7 @@
 
 #include "rotor/wx/supervisor_wx.h"
 #include <wx/timer.h>
+#include <vector>
 
 using namespace rotor::wx;
 using namespace rotor;
@@ -66,6 +67,7 @@ void supervisor_wx_t::shutdown() noexcept {
 }
 
 void supervisor_wx_t::enqueue(message_ptr_t message) noexcept {
+    message->share();
     supervisor_ptr_t self{this};
     handler->CallAfter([self = std::move(self), message = std::move(message)]() {
         auto &sup = *self;
@@ -74,6 +76,24 @@ void supervisor_wx_t::enqueue(message_ptr_t message) noexcept {
     });
 }
 
+void supervisor_wx_t::enqueue_batch(messages_queue_t &messages) noexcept {
+    using batch_t = std::vector<message_ptr_t>;
+    supervisor_ptr_t self{this};
+    auto batch = batch_t();
+    batch.reserve(messages.size());
+    while (!messages.empty()) {
+        batch.emplace_back(messages.take_front());
+        batch.back()->share();
+    }
+    handler->CallAfter([self = std::move(self), batch = std::move(batch)]() {
+        auto &sup = *self;
+        for (auto &message : batch) {
+            sup.put(message);
+        }
+        sup.do_process();
+    });
+}
+
 void supervisor_wx_t::do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept {
     auto self = timer_t::supervisor_ptr_t(this);
     auto timer = std::make_unique<timer_t>(&handler, std::move(self));
@@ -82,7 +102,8 @@ void supervisor_wx_t::do_start_timer(const pt::time_duration &interval, timer_ha
     timers_map.emplace(handler.request_id, std::move(timer));
 }
 
-void supervisor_wx_t::do_cancel_timer(request_id_t timer_id) noexcept {
+void supervisor_wx_t::do_cancel_timer(timer_handler_base_t &handler) noexcept {
+    auto timer_id = handler.request_id;
     try {
         auto &timer = timers_map.at(timer_id);
         timer->Stop();
@@ -7,6 +7,11 @@
 #include "rotor.hpp"
 #include "access.h"
 #include "supervisor_test.h"
+#include "rotor/misc/binary_trace_sink.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
 
 namespace r = rotor;
 namespace rt = r::test;
@@ -35,7 +40,12 @@ struct pinger_t : public r::actor_base_t {
         send<ping_t>(ponger_addr);
     }
 
-    void on_pong(r::message_t<pong_t> &) noexcept { ++pong_received; }
+    void on_pong(r::message_t<pong_t> &msg) noexcept {
+        ++pong_received;
+        pong_pool = msg.pool;
+    }
+
+    r::message_pool_t *pong_pool = nullptr;
 
     r::address_ptr_t ponger_addr;
 };
@@ -90,3 +100,316 @@ TEST_CASE("ping-pong", "[supervisor]") {
     ponger.reset();
     REQUIRE(destroyed == 4);
 }
+
+TEST_CASE("ping-pong with pooled messages", "[supervisor]") {
+    r::system_context_t system_context;
+    destroyed = 0;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .timeout(rt::default_timeout)
+                   .pool_messages()
+                   .finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->set_pinger_addr(pinger->get_address());
+
+    sup->do_process();
+    REQUIRE(pinger->ping_sent == 1);
+    REQUIRE(pinger->pong_received == 1);
+    REQUIRE(ponger->pong_sent == 1);
+    REQUIRE(ponger->ping_received == 1);
+    CHECK(pinger->pong_pool);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+
+    pinger.reset();
+    ponger.reset();
+    REQUIRE(destroyed == 4);
+}
+
+TEST_CASE("ping-pong with pinned addresses", "[supervisor]") {
+    r::system_context_t system_context;
+    destroyed = 0;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .timeout(rt::default_timeout)
+                   .pin_addresses()
+                   .finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->set_pinger_addr(pinger->get_address());
+
+    sup->do_process();
+    REQUIRE(pinger->ping_sent == 1);
+    REQUIRE(pinger->pong_received == 1);
+    REQUIRE(ponger->pong_sent == 1);
+    REQUIRE(ponger->ping_received == 1);
+
+    auto &addr = pinger->get_address();
+    CHECK(addr->pinned);
+    CHECK(sup->get_address()->pinned);
+    CHECK(addr->use_count() == 0);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+
+    pinger.reset();
+    ponger.reset();
+    REQUIRE(destroyed == 4);
+}
+
+TEST_CASE("pinned addresses of removed child supervisors are not re-used", "[supervisor]") {
+    r::system_context_t system_context;
+    auto &pinned = system_context.access<rt::to::pinned_addresses>();
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .timeout(rt::default_timeout)
+                   .pin_addresses()
+                   .finish();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::OPERATIONAL);
+
+    auto stale_addresses = std::set<const r::address_t *>();
+    for (int i = 0; i < 3; ++i) {
+        auto child = sup->create_actor<rt::supervisor_test_t>()
+                         .timeout(rt::default_timeout)
+                         .pin_addresses()
+                         .finish();
+        auto pinger = child->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+        auto ponger = child->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+        pinger->set_ponger_addr(ponger->get_address());
+        ponger->set_pinger_addr(pinger->get_address());
+        sup->do_process();
+        REQUIRE(pinger->pong_received == 1);
+        CHECK(pinger->get_address()->pinned);
+
+        for (auto &addr : {child->get_address(), pinger->get_address(), ponger->get_address()}) {
+            CHECK(stale_addresses.count(addr.get()) == 0);
+            stale_addresses.emplace(addr.get());
+        }
+
+        child->do_shutdown();
+        sup->do_process();
+        REQUIRE(child->get_state() == r::state_t::SHUT_DOWN);
+    }
+    // the memory of the addresses is still owned by the system context
+    CHECK(pinned.size() >= stale_addresses.size());
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+}
+
+struct trace_recorder_t : r::trace_sink_t {
+    void record(const r::supervisor_t &, const r::message_base_t &message, r::trace_event_t event,
+                std::size_t) noexcept override {
+        if (message.type_index == r::message_t<ping_t>::message_type) {
+            ++pings;
+        }
+        if (event == r::trace_event_t::discarded) {
+            ++discarded;
+        }
+        ++total;
+    }
+
+    int pings = 0;
+    int discarded = 0;
+    int total = 0;
+};
+
+TEST_CASE("ping-pong with trace sink", "[supervisor]") {
+    r::system_context_t system_context;
+    trace_recorder_t recorder;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->set_pinger_addr(pinger->get_address());
+
+    sup->trace(&recorder);
+    sup->do_process();
+    REQUIRE(pinger->pong_received == 1);
+    CHECK(recorder.pings == 1);
+    CHECK(recorder.total > 2);
+
+    auto total = recorder.total;
+    sup->trace(nullptr);
+    sup->send<ping_t>(sup->get_address());
+    sup->do_process();
+    CHECK(recorder.total == total);
+
+    sup->trace(&recorder);
+    sup->send<ping_t>(sup->get_address());
+    sup->do_process();
+    CHECK(recorder.pings == 2);
+    CHECK(recorder.discarded == 1);
+
+    sup->trace(nullptr);
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("trace sink of child supervisor", "[supervisor]") {
+    struct recorder_t : trace_recorder_t {
+        void record(const r::supervisor_t &sup, const r::message_base_t &message, r::trace_event_t event,
+                    std::size_t depth) noexcept override {
+            destinations.emplace(&message.address->supervisor);
+            trace_recorder_t::record(sup, message, event, depth);
+        }
+        std::set<const r::supervisor_t *> destinations;
+    };
+
+    r::system_context_t system_context;
+    recorder_t recorder;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto child = sup->create_actor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = child->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->set_pinger_addr(pinger->get_address());
+
+    child->trace(&recorder);
+    sup->do_process();
+    REQUIRE(pinger->pong_received == 1);
+    CHECK(recorder.pings == 1);
+    CHECK(recorder.destinations == std::set<const r::supervisor_t *>{child.get()});
+
+    child->trace(nullptr);
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+template <typename T> struct first_wrapper_of_payload_with_a_rather_long_name_t {};
+template <typename T> struct second_wrapper_of_payload_with_a_rather_long_name_t {};
+template <typename T> struct third_wrapper_of_payload_with_a_rather_long_name_t {};
+using long_payload_t = first_wrapper_of_payload_with_a_rather_long_name_t<
+    second_wrapper_of_payload_with_a_rather_long_name_t<third_wrapper_of_payload_with_a_rather_long_name_t<ping_t>>>;
+using long_message_t = r::message_t<long_payload_t>;
+
+static std::string read_type_name(std::ifstream &in, const r::misc::trace_file_header_t &header,
+                                  r::message_type_id_t type_id) {
+    namespace rm = r::misc;
+    rm::trace_type_name_t entry;
+    in.seekg(static_cast<std::streamoff>(sizeof(header) + type_id * sizeof(entry)));
+    REQUIRE(in.read(reinterpret_cast<char *>(&entry), sizeof(entry)));
+    if (entry.offset == rm::trace_type_name_t::lost_offset) {
+        return {};
+    }
+    std::string name(entry.length, '\0');
+    in.seekg(static_cast<std::streamoff>(sizeof(header) + header.max_types * sizeof(entry) + entry.offset));
+    REQUIRE(in.read(name.data(), static_cast<std::streamsize>(name.size())));
+    return name;
+}
+
+TEST_CASE("ping-pong with binary trace", "[supervisor]") {
+    namespace rm = r::misc;
+    auto path = (std::filesystem::temp_directory_path() / "rotor-011-ping_pong.trace").string();
+    auto capacity = std::size_t{4};
+    auto max_types = std::uint32_t{1024};
+    auto long_name = std::string(static_cast<const char *>(long_message_t::message_type));
+    REQUIRE(long_name.size() > rm::trace_file_header_t::type_name_size);
+
+    auto names_capacity = std::size_t{1024 * rm::trace_file_header_t::type_name_size};
+    SECTION("names are stored without truncation") {}
+    SECTION("names, which do not fit, are marked as lost") { names_capacity = 100; }
+
+    {
+        rm::binary_trace_sink_t sink(path, capacity, max_types, names_capacity);
+        r::system_context_t system_context;
+
+        auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+        auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+        auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+        pinger->set_ponger_addr(ponger->get_address());
+        ponger->set_pinger_addr(pinger->get_address());
+
+        sup->trace(&sink);
+        sup->do_process();
+        REQUIRE(pinger->pong_received == 1);
+        sup->send<long_payload_t>(sup->get_address());
+        sup->do_process();
+        sup->trace(nullptr);
+
+        sup->do_shutdown();
+        sup->do_process();
+        REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    }
+
+    std::ifstream in(path, std::ios_base::binary);
+    rm::trace_file_header_t header;
+    REQUIRE(in.read(reinterpret_cast<char *>(&header), sizeof(header)));
+    CHECK(header.magic == rm::trace_file_header_t::magic_value);
+    CHECK(header.record_size == sizeof(rm::trace_record_t));
+    CHECK(header.capacity == capacity);
+    CHECK(header.max_types == max_types);
+    CHECK(header.names_capacity == names_capacity);
+    CHECK(header.names_used <= names_capacity);
+    CHECK(header.written > capacity);
+
+    auto long_id = long_message_t::message_type_id;
+    if (names_capacity > long_name.size()) {
+        auto ping_id = r::message_t<ping_t>::message_type_id;
+        CHECK(read_type_name(in, header, ping_id) == static_cast<const char *>(r::message_t<ping_t>::message_type));
+        CHECK(read_type_name(in, header, long_id) == long_name);
+    } else {
+        CHECK(read_type_name(in, header, long_id).empty());
+    }
+
+    in.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("ping-pong delivery stats", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->set_ponger_addr(ponger->get_address());
+    ponger->set_pinger_addr(pinger->get_address());
+
+    sup->do_process();
+    REQUIRE(pinger->pong_received == 1);
+    sup->send<ping_t>(sup->get_address());
+    sup->do_process();
+
+    auto stats = system_context.get_delivery_stats();
+    std::uint64_t batches = 0;
+    for (auto value : stats.batches) {
+        batches += value;
+    }
+#if defined(ROTOR_DELIVERY_STATS)
+    CHECK(stats.dispatched > 2);
+    CHECK(stats.discarded == 1);
+    CHECK(stats.forwarded == 0);
+    CHECK(stats.max_queue_depth > 1);
+    CHECK(batches == 2);
+#else
+    CHECK(stats.dispatched == 0);
+    CHECK(stats.max_queue_depth == 0);
+    CHECK(batches == 0);
+#endif
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
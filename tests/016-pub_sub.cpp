@@ -83,3 +83,116 @@ TEST_CASE("ping-pong-pub-sub", "[supervisor]") {
     REQUIRE(sup->get_points().size() == 0);
     CHECK(rt::empty(sup->get_subscription()));
 }
+
+struct multi_sub_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+    using addresses_t = std::vector<r::address_ptr_t>;
+
+    void subscribe_all(const addresses_t &addresses) {
+        for (auto &addr : addresses) {
+            subscribe(&multi_sub_t::on_payload, addr);
+        }
+    }
+
+    void on_payload(r::message_t<payload_t> &) noexcept { ++received; }
+
+    std::size_t received = 0;
+};
+
+TEST_CASE("many addresses with many subscribers", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto sub1 = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    auto sub2 = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    auto sub3 = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    multi_sub_t::addresses_t addresses;
+    for (int i = 0; i < 100; ++i) {
+        addresses.emplace_back(sup->create_address());
+    }
+    sub1->subscribe_all(addresses);
+    sub2->subscribe_all(addresses);
+    sub3->subscribe_all(addresses);
+    sup->do_process();
+
+    auto publish = [&]() {
+        for (auto &addr : addresses) {
+            sup->send<payload_t>(addr);
+        }
+        sup->do_process();
+    };
+
+    publish();
+    CHECK(sub1->received == 100);
+    CHECK(sub2->received == 100);
+    CHECK(sub3->received == 100);
+
+    sub2->do_shutdown();
+    sup->do_process();
+    publish();
+    CHECK(sub1->received == 200);
+    CHECK(sub2->received == 100);
+    CHECK(sub3->received == 200);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("single recipient cache", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto sub1 = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    auto sub2 = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    auto addr = sup->create_address();
+    auto message_type = r::message_t<payload_t>::message_type;
+    CHECK(!addr->cached_type);
+
+    auto publish = [&]() {
+        sup->send<payload_t>(addr);
+        sup->do_process();
+    };
+
+    sub1->subscribe_all({addr});
+    sup->do_process();
+    CHECK(addr->cached_type == message_type);
+    CHECK(addr->cached_handler);
+    publish();
+    CHECK(sub1->received == 1);
+
+    sub2->subscribe_all({addr});
+    sup->do_process();
+    CHECK(!addr->cached_type);
+    CHECK(!addr->cached_handler);
+    publish();
+    CHECK(sub1->received == 2);
+    CHECK(sub2->received == 1);
+
+    auto id = &std::as_const(r::plugin::lifetime_plugin_t::class_identity);
+    auto lifetime = static_cast<r::plugin::lifetime_plugin_t *>(sub1->access<rt::to::get_plugin>(id));
+    auto handler = r::wrap_handler(*sub1, &multi_sub_t::on_payload);
+    CHECK(lifetime->is_subscribed(*handler, *addr));
+    CHECK(!lifetime->is_subscribed(*handler, *sup->get_address()));
+
+    sub1->do_shutdown();
+    sup->do_process();
+    CHECK(addr->cached_type == message_type);
+    CHECK(addr->cached_handler);
+    publish();
+    CHECK(sub1->received == 2);
+    CHECK(sub2->received == 2);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(!addr->cached_type);
+    CHECK(!addr->cached_handler);
+    CHECK(rt::empty(sup->get_subscription()));
+}
@@ -442,6 +442,88 @@ struct order_actor_t : r::actor_base_t {
     int order;
 };
 
+struct coarse_actor_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+    using requests_t = std::vector<req_ptr_t>;
+    int timeouts = 0;
+    int responses = 0;
+    requests_t requests;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&coarse_actor_t::on_request);
+            p.subscribe_actor(&coarse_actor_t::on_response);
+        });
+    }
+
+    void shutdown_start() noexcept override {
+        requests.clear();
+        r::actor_base_t::shutdown_start();
+    }
+
+    void do_requests() noexcept {
+        for (int i = 0; i < 3; ++i) {
+            request<request_sample_t>(address, i).send(r::pt::minutes(1));
+        }
+    }
+
+    void on_request(traits_t::request::message_t &msg) noexcept {
+        if (msg.payload.request_payload.value == 0) {
+            reply_to(msg, 5);
+        } else {
+            requests.emplace_back(&msg);
+        }
+    }
+
+    void on_response(traits_t::response::message_t &msg) noexcept {
+        if (msg.payload.ee) {
+            CHECK(msg.payload.ee->ec == r::error_code_t::request_timeout);
+            ++timeouts;
+        } else {
+            ++responses;
+        }
+    }
+};
+
+struct direct_actor_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+    bool keep_response = false;
+    r::message_ptr_t response;
+    const void *sent = nullptr;
+    const void *received = nullptr;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&direct_actor_t::on_request);
+            p.subscribe_actor(&direct_actor_t::on_response);
+        });
+    }
+
+    void shutdown_start() noexcept override {
+        response.reset();
+        r::actor_base_t::shutdown_start();
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        request<request_sample_t>(address, 4).send(rt::default_timeout);
+    }
+
+    void on_request(traits_t::request::message_t &msg) noexcept {
+        auto res = make_response(msg, 5);
+        sent = res.get();
+        if (keep_response) {
+            response = res;
+        }
+        supervisor->put(std::move(res));
+    }
+
+    void on_response(traits_t::response::message_t &msg) noexcept {
+        CHECK(msg.payload.res.value == 5);
+        received = &msg;
+    }
+};
+
 TEST_CASE("request-response successful delivery", "[actor]") {
     r::system_context_t system_context;
 
@@ -795,6 +877,25 @@ TEST_CASE("request timer should not outlive requestee", "[actor]") {
     REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
 }
 
+TEST_CASE("unsent request does not occupy request slot", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<r::actor_base_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    {
+        auto builder = act->request<request_sample_t>(sup->get_address(), 5);
+        CHECK(sup->get_requests().empty());
+    }
+    CHECK(sup->get_requests().empty());
+    CHECK(act->access<rt::to::active_requests>().empty());
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
 TEST_CASE("response and regular messages keep send order", "[actor]") {
     r::system_context_t system_context;
 
@@ -808,3 +909,95 @@ TEST_CASE("response and regular messages keep send order", "[actor]") {
     sup->do_process();
     REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
 }
+
+TEST_CASE("coarse request timeouts", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .timeout(rt::default_timeout)
+                   .timeout_granularity(r::pt::seconds(1))
+                   .finish();
+    auto act = sup->create_actor<coarse_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(sup->active_timers.size() == 0);
+
+    SECTION("timeout") {
+        act->do_requests();
+        sup->do_process();
+        CHECK(act->responses == 1);
+        CHECK(act->timeouts == 0);
+        CHECK(sup->get_requests().size() == 2);
+        REQUIRE(sup->active_timers.size() == 1);
+
+        sup->do_invoke_timer((*sup->active_timers.begin())->request_id);
+        sup->do_process();
+        CHECK(act->responses == 1);
+        CHECK(act->timeouts == 2);
+        CHECK(sup->get_requests().size() == 0);
+        CHECK(act->access<rt::to::active_requests>().empty());
+
+        act->reply_to(*act->requests.front(), 1);
+        sup->do_process();
+        CHECK(act->responses == 1);
+    }
+
+    SECTION("distinct deadlines") {
+        act->do_requests();
+        sup->current_time += std::chrono::seconds(2);
+        act->do_requests();
+        sup->do_process();
+        CHECK(act->responses == 2);
+        CHECK(sup->get_requests().size() == 4);
+        REQUIRE(sup->active_timers.size() == 2);
+
+        sup->do_invoke_timer(sup->active_timers.front()->request_id);
+        sup->do_process();
+        CHECK(act->timeouts == 2);
+        CHECK(sup->get_requests().size() == 2);
+        CHECK(sup->active_timers.size() == 1);
+    }
+
+    SECTION("cancellation on shutdown") {
+        act->do_requests();
+        sup->do_process();
+        REQUIRE(sup->active_timers.size() == 1);
+
+        act->do_shutdown();
+        sup->do_process();
+        CHECK(act->timeouts == 0);
+        CHECK(sup->get_requests().size() == 0);
+        CHECK(sup->active_timers.size() == 0);
+    }
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->active_timers.size() == 0);
+}
+
+TEST_CASE("local response is delivered in place", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<direct_actor_t>().timeout(rt::default_timeout).finish();
+
+    SECTION("exclusively owned response is retargeted") {
+        sup->do_process();
+        CHECK(act->received);
+        CHECK(act->received == act->sent);
+    }
+
+    SECTION("shared response is copied") {
+        act->keep_response = true;
+        sup->do_process();
+        CHECK(act->received);
+        CHECK(act->received != act->sent);
+    }
+
+    CHECK(sup->get_requests().empty());
+    CHECK(sup->active_timers.size() == 0);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
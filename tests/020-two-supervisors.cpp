@@ -55,12 +55,20 @@ struct my_supervisor_t : public rt::supervisor_test_t {
         assert(state == r::state_t::SHUT_DOWN);
     }
 
+    void enqueue_batch(r::messages_queue_t &messages) noexcept override {
+        ++batches_count;
+        batched_messages += messages.size();
+        rt::supervisor_test_t::enqueue_batch(messages);
+    }
+
     ~my_supervisor_t() { ++destroyed; }
 
     std::uint32_t init_start_count = 0;
     std::uint32_t init_finish_count = 0;
     std::uint32_t shutdown_start_count = 0;
     std::uint32_t shutdown_finish_count = 0;
+    std::uint32_t batches_count = 0;
+    std::size_t batched_messages = 0;
 };
 
 TEST_CASE("two supervisors, different localities, shutdown 2nd", "[supervisor]") {
@@ -409,3 +417,100 @@ TEST_CASE("message arrival order", "[supervisor]") {
     REQUIRE(sup1->get_state() == r::state_t::SHUT_DOWN);
     REQUIRE(sup2->get_state() == r::state_t::SHUT_DOWN);
 }
+
+TEST_CASE("messages to other locality are enqueued in batch", "[supervisor]") {
+    r::system_context_t system_context;
+
+    const char locality1[] = "abc";
+    const char locality2[] = "def";
+    auto sup1 =
+        system_context.create_supervisor<my_supervisor_t>().locality(locality1).timeout(rt::default_timeout).finish();
+    auto sup2 = sup1->create_actor<my_supervisor_t>().locality(locality2).timeout(rt::default_timeout).finish();
+
+    while (!sup1->get_leader_queue().empty() || !sup2->get_leader_queue().empty()) {
+        sup1->do_process();
+        sup2->do_process();
+    }
+    REQUIRE(sup1->get_state() == r::state_t::OPERATIONAL);
+    REQUIRE(sup2->get_state() == r::state_t::OPERATIONAL);
+
+    sup2->batches_count = 0;
+    sup2->batched_messages = 0;
+    for (int i = 0; i < 3; ++i) {
+        sup1->send<rt::payload::sample_t>(sup2->get_address(), i);
+    }
+    sup1->do_process();
+    CHECK(sup2->batches_count == 1);
+    CHECK(sup2->batched_messages == 3);
+    CHECK(sup2->get_leader_queue().size() == 3);
+
+    sup1->do_shutdown();
+    while (!sup1->get_leader_queue().empty() || !sup2->get_leader_queue().empty()) {
+        sup1->do_process();
+        sup2->do_process();
+    }
+    CHECK(sup1->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup2->get_state() == r::state_t::SHUT_DOWN);
+}
+
+struct foreign_sub_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>(
+            [this](auto &p) { p.subscribe_actor(&foreign_sub_t::on_sample, foreign_addr); });
+    }
+
+    void on_sample(rt::message::sample_t &) noexcept { ++received; }
+
+    std::size_t received = 0;
+    r::address_ptr_t foreign_addr;
+};
+
+TEST_CASE("foreign handler call after shutdown is dropped", "[supervisor]") {
+    r::system_context_t system_context;
+
+    const char locality1[] = "abc";
+    const char locality2[] = "def";
+    auto sup1 = system_context.create_supervisor<rt::supervisor_test_t>()
+                    .locality(locality1)
+                    .timeout(rt::default_timeout)
+                    .finish();
+    auto sup2 = sup1->create_actor<rt::supervisor_test_t>().locality(locality2).timeout(rt::default_timeout).finish();
+    auto addr = sup1->create_address();
+    auto act = sup2->create_actor<foreign_sub_t>().timeout(rt::default_timeout).finish();
+    act->foreign_addr = addr;
+
+    auto process = [&]() {
+        while (!sup1->get_leader_queue().empty() || !sup2->get_leader_queue().empty()) {
+            sup1->do_process();
+            sup2->do_process();
+        }
+    };
+    process();
+    REQUIRE(act->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    sup1->send<rt::payload::sample_t>(addr, 1);
+    process();
+    CHECK(act->received == 1);
+
+    sup1->send<rt::payload::sample_t>(addr, 2);
+    sup1->do_process();
+    REQUIRE(sup2->get_leader_queue().size() == 1);
+    auto call = sup2->get_leader_queue().take_front();
+    CHECK(call->type_index == r::message::handler_call_t::message_type);
+
+    act->do_shutdown();
+    sup2->do_process();
+    CHECK(act->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+
+    sup2->get_leader_queue().push_back(std::move(call));
+    process();
+    CHECK(act->received == 1);
+
+    sup1->do_shutdown();
+    process();
+    CHECK(sup1->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup2->get_state() == r::state_t::SHUT_DOWN);
+}
@@ -0,0 +1,238 @@
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor.hpp"
+#include "supervisor_test.h"
+#include "access.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#include "rotor/coro.hpp"
+
+namespace r = rotor;
+namespace rc = rotor::coro;
+namespace rt = r::test;
+
+struct response_sample_t {
+    int value;
+};
+
+struct request_sample_t {
+    using response_t = response_sample_t;
+
+    int value;
+};
+
+using traits_t = r::request_traits_t<request_sample_t>;
+using request_message_t = traits_t::request::message_t;
+
+struct responder_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    bool postpone = false;
+    std::vector<r::intrusive_ptr_t<request_message_t>> postponed;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&responder_t::on_request); });
+    }
+
+    void shutdown_start() noexcept override {
+        postponed.clear();
+        r::actor_base_t::shutdown_start();
+    }
+
+    void on_request(request_message_t &msg) noexcept {
+        if (postpone) {
+            postponed.emplace_back(&msg);
+        } else {
+            reply_to(msg, msg.payload.request_payload.value * 10);
+        }
+    }
+};
+
+struct guard_t {
+    int &counter;
+    ~guard_t() { ++counter; }
+};
+
+/* records the coroutine frame address without suspension */
+struct frame_probe_t {
+    void *frame = nullptr;
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        frame = handle.address();
+        return false;
+    }
+    void *await_resume() const noexcept { return frame; }
+};
+
+struct requester_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    r::address_ptr_t responder;
+    std::vector<int> results;
+    std::vector<r::extended_error_ptr_t> errors;
+    std::vector<void *> frames;
+    int finished = 0;
+
+    rc::task_t make_request(int value) {
+        guard_t guard{finished};
+        frames.emplace_back(co_await frame_probe_t{});
+        auto reply = co_await rc::send(request<request_sample_t>(responder, value), rt::default_timeout);
+        if (reply->payload.ee) {
+            errors.emplace_back(reply->payload.ee);
+        } else {
+            results.emplace_back(reply->payload.res.value);
+        }
+    }
+
+    rc::task_t make_chain(int value) {
+        guard_t guard{finished};
+        auto reply = co_await rc::send(request<request_sample_t>(responder, value), rt::default_timeout);
+        auto next_value = reply->payload.res.value;
+        reply = co_await rc::send(request<request_sample_t>(responder, next_value), rt::default_timeout);
+        results.emplace_back(reply->payload.res.value);
+    }
+
+    void drop_request(int value) {
+        [[maybe_unused]] auto awaiter = rc::send(request<request_sample_t>(responder, value), rt::default_timeout);
+    }
+};
+
+TEST_CASE("awaitable requests are pipelined", "[coro]") {
+    r::system_context_t system_context;
+    auto pool_messages = false;
+    SECTION("heap frames") {}
+    SECTION("pooled frames") { pool_messages = true; }
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .timeout(rt::default_timeout)
+                   .pool_messages(pool_messages)
+                   .finish();
+    auto responder = sup->create_actor<responder_t>().timeout(rt::default_timeout).finish();
+    auto requester = sup->create_actor<requester_t>().timeout(rt::default_timeout).finish();
+    requester->responder = responder->get_address();
+    sup->do_process();
+    REQUIRE(requester->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    auto pool = sup->access<rt::to::message_pool>().get();
+    CHECK((pool != nullptr) == pool_messages);
+    {
+        // as if the coroutines are started from message handlers
+        r::message_pool_t::guard_t guard(pool);
+        for (int i = 1; i <= 3; ++i) {
+            requester->make_request(i);
+        }
+        requester->make_chain(4);
+    }
+    CHECK(requester->finished == 0);
+    CHECK(sup->get_requests().size() == 4);
+    REQUIRE(requester->frames.size() == 3);
+    for (auto frame : requester->frames) {
+        auto header = static_cast<rc::details::frame_header_t *>(frame) - 1;
+        CHECK(header->pool == pool);
+    }
+
+    sup->do_process();
+    CHECK(requester->finished == 4);
+    CHECK(requester->results == std::vector<int>{10, 20, 30, 400});
+    CHECK(requester->errors.empty());
+    CHECK(sup->get_requests().size() == 0);
+    CHECK(sup->active_timers.size() == 0);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("awaitable request timeout", "[coro]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto responder = sup->create_actor<responder_t>().timeout(rt::default_timeout).finish();
+    auto requester = sup->create_actor<requester_t>().timeout(rt::default_timeout).finish();
+    requester->responder = responder->get_address();
+    responder->postpone = true;
+    sup->do_process();
+
+    requester->make_request(1);
+    sup->do_process();
+    REQUIRE(responder->postponed.size() == 1);
+    REQUIRE(sup->active_timers.size() == 1);
+    CHECK(requester->finished == 0);
+
+    auto timer = *sup->active_timers.begin();
+    sup->active_timers.clear();
+    ((r::actor_base_t *)sup.get())->access<rt::to::on_timer_trigger, r::request_id_t, bool>(timer->request_id, false);
+    REQUIRE(requester->finished == 1);
+    REQUIRE(requester->errors.size() == 1);
+    CHECK(requester->errors.front()->ec == r::error_code_t::request_timeout);
+    CHECK(requester->results.empty());
+
+    // late response is dropped
+    responder->reply_to(*responder->postponed.front(), 5);
+    sup->do_process();
+    CHECK(requester->finished == 1);
+    CHECK(requester->results.empty());
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+}
+
+TEST_CASE("unsent awaitable request is dropped safely", "[coro]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto responder = sup->create_actor<responder_t>().timeout(rt::default_timeout).finish();
+    auto requester = sup->create_actor<requester_t>().timeout(rt::default_timeout).finish();
+    requester->responder = responder->get_address();
+    sup->do_process();
+
+    requester->drop_request(1);
+    CHECK(sup->get_requests().size() == 0);
+    CHECK(sup->active_timers.size() == 0);
+    sup->do_process();
+    CHECK(requester->results.empty());
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+}
+
+TEST_CASE("awaiting coroutine is destroyed on requester shutdown", "[coro]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto responder = sup->create_actor<responder_t>().timeout(rt::default_timeout).finish();
+    auto requester = sup->create_actor<requester_t>().timeout(rt::default_timeout).finish();
+    requester->responder = responder->get_address();
+    responder->postpone = true;
+    sup->do_process();
+
+    requester->make_request(1);
+    requester->make_request(2);
+    sup->do_process();
+    REQUIRE(responder->postponed.size() == 2);
+    CHECK(requester->finished == 0);
+
+    requester->do_shutdown();
+    sup->do_process();
+    CHECK(requester->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    CHECK(requester->finished == 2);
+    CHECK(requester->results.empty());
+    CHECK(requester->errors.empty());
+    CHECK(sup->get_requests().size() == 0);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+}
+
+#endif
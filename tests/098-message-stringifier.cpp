@@ -37,6 +37,7 @@ TEST_CASE("default message stringifier", "[misc]") {
         auto start_message = r::make_message<r::payload::start_actor_t>(sup->get_address());
         auto message = stringifer.stringify(*start_message);
         CHECK_THAT(message, StartsWith("r::start_trigger @"));
+        CHECK(r::plugin::inspected_local_delivery_t::get_level(*start_message) == 10);
     }
 
     SECTION("unknown / non-rotor message") {
@@ -46,6 +47,7 @@ TEST_CASE("default message stringifier", "[misc]") {
         CHECK_THAT(message, ContainsSubstring("rotor::message_t"));
         CHECK_THAT(message, ContainsSubstring("payload::ping_t"));
         CHECK_THAT(message, ContainsSubstring(" =>"));
+        CHECK(r::plugin::inspected_local_delivery_t::get_level(*ping) == 0);
     }
 
     SECTION("extended error") {
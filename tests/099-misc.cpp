@@ -6,6 +6,7 @@
 
 #include "rotor.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <thread>
 
 namespace r = rotor;
 
@@ -16,3 +17,318 @@ TEST_CASE("error code messages", "[misc]") {
     CHECK(r::shutdown_code_category().name() == std::string("rotor_shutdown"));
     CHECK(r::shutdown_code_category().message(-1) == "unknown shutdown reason");
 }
+
+TEST_CASE("message pool", "[misc]") {
+    r::message_pool_ptr_t pool(new r::message_pool_t());
+    CHECK(!pool->allocate(r::message_pool_t::max_size + 1));
+
+    SECTION("blocks are reused within the size class") {
+        r::message_pool_t::guard_t guard(pool.get());
+        auto ptr_1 = pool->allocate(10);
+        REQUIRE(ptr_1);
+        pool->deallocate(ptr_1);
+        auto ptr_2 = pool->allocate(r::message_pool_t::granularity);
+        CHECK(ptr_1 == ptr_2);
+        auto ptr_3 = pool->allocate(r::message_pool_t::granularity + 1);
+        CHECK(ptr_3 != ptr_2);
+        pool->deallocate(ptr_2);
+        pool->deallocate(ptr_3);
+    }
+
+    SECTION("blocks released on foreign thread are reclaimed") {
+        auto ptr_1 = pool->allocate(10);
+        auto thread = std::thread([&]() { pool->deallocate(ptr_1); });
+        thread.join();
+        auto ptr_2 = pool->allocate(10);
+        CHECK(ptr_1 == ptr_2);
+        pool->deallocate(ptr_2);
+    }
+
+    SECTION("orphaned pool is alive until the last block is released") {
+        auto ptr_1 = pool->allocate(10);
+        auto ptr_2 = pool->allocate(r::message_pool_t::max_size);
+        auto ptr_3 = pool->allocate(10);
+        auto thread = std::thread([&]() { pool->deallocate(ptr_3); });
+        thread.join();
+        auto raw_pool = pool.get();
+        pool.reset();
+        raw_pool->deallocate(ptr_1);
+        thread = std::thread([&]() { raw_pool->deallocate(ptr_2); });
+        thread.join();
+    }
+}
+
+TEST_CASE("messages queue", "[misc]") {
+    using message_t = r::message_t<int>;
+    auto make_message = [](int value) { return r::message_ptr_t(new message_t(r::address_ptr_t(), value)); };
+    auto value_of = [](const r::message_ptr_t &message) { return static_cast<message_t *>(message.get())->payload; };
+
+    r::messages_queue_t queue;
+    CHECK(queue.empty());
+    // wrap around the ring and grow
+    for (int i = 0; i < 100; ++i) {
+        queue.push_back(make_message(i));
+        if (i % 2) {
+            queue.pop_front();
+        }
+    }
+    queue.push_front(make_message(-1));
+    REQUIRE(queue.size() == 51);
+    CHECK(value_of(queue.front()) == -1);
+    CHECK(value_of(queue[1]) == 50);
+    CHECK(value_of(queue.back()) == 99);
+
+    auto copy = r::messages_queue_t();
+    copy.push_back(make_message(1000));
+    copy = queue;
+    REQUIRE(copy.size() == queue.size());
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        CHECK(copy[i] == queue[i]);
+    }
+    CHECK(queue.front()->use_count() == 2);
+
+    auto moved = r::messages_queue_t();
+    moved.push_back(make_message(1000));
+    moved = std::move(copy);
+    CHECK(copy.empty());
+    REQUIRE(moved.size() == 51);
+    CHECK(value_of(moved.take_back()) == 99);
+
+    moved.clear();
+    CHECK(moved.empty());
+    CHECK(queue.front()->use_count() == 1);
+    moved.push_back(make_message(7));
+    CHECK(value_of(moved.front()) == 7);
+}
+
+static void check_inbound_queue(bool intrusive) {
+    using message_t = r::message_t<int>;
+    static constexpr int per_thread = 1000;
+    auto make_message = [](int value) { return r::message_ptr_t(new message_t(r::address_ptr_t(), value)).detach(); };
+    auto value_of = [](r::message_base_t *message) {
+        auto value = static_cast<message_t *>(message)->payload;
+        intrusive_ptr_release(message);
+        return value;
+    };
+
+    r::inbound_queue_t queue(intrusive);
+    CHECK(queue.is_intrusive() == intrusive);
+    CHECK(queue.empty());
+
+    // fifo order
+    queue.push(make_message(1));
+    queue.push(make_message(2));
+    CHECK(!queue.empty());
+
+    r::message_base_t *ptr = nullptr;
+    REQUIRE(queue.pop(ptr));
+    CHECK(value_of(ptr) == 1);
+    queue.push(make_message(3));
+    REQUIRE(queue.pop(ptr));
+    CHECK(value_of(ptr) == 2);
+    REQUIRE(queue.pop(ptr));
+    CHECK(value_of(ptr) == 3);
+    CHECK(!queue.pop(ptr));
+    CHECK(queue.empty());
+
+    // multiple producers
+    auto producer = [&](int base) {
+        for (int i = 0; i < per_thread; ++i) {
+            queue.push(make_message(base + i));
+        }
+    };
+    auto thread_1 = std::thread(producer, 0);
+    auto thread_2 = std::thread(producer, per_thread);
+    thread_1.join();
+    thread_2.join();
+
+    int last[2] = {-1, per_thread - 1};
+    int count = 0;
+    while (queue.pop(ptr)) {
+        auto value = value_of(ptr);
+        auto &prev = last[value / per_thread];
+        CHECK(value > prev);
+        prev = value;
+        ++count;
+    }
+    CHECK(count == per_thread * 2);
+
+    // pending messages are released by the queue
+    queue.push(make_message(4));
+}
+
+TEST_CASE("inbound queue", "[misc]") {
+    SECTION("lock-free queue") { check_inbound_queue(false); }
+    SECTION("intrusive queue") { check_inbound_queue(true); }
+}
+
+#if defined(ROTOR_REFCOUNT_HYBRID)
+namespace {
+namespace hybrid {
+struct response_t {
+    int value;
+};
+
+struct request_t {
+    using response_t = hybrid::response_t;
+    int value;
+};
+} // namespace hybrid
+} // namespace
+
+TEST_CASE("hybrid refcount", "[misc]") {
+    using message_t = r::message_t<int>;
+    auto make_message = [](int value) { return r::message_ptr_t(new message_t(r::address_ptr_t(), value)); };
+
+    SECTION("local message is not shared") {
+        auto message = make_message(1);
+        auto copy = message;
+        r::messages_queue_t queue;
+        queue.emplace_back(copy);
+        CHECK(!message->is_shared());
+        CHECK(message->use_count() == 3);
+    }
+
+    SECTION("enqueued message is shared") {
+        auto message = make_message(1);
+        r::inbound_queue_t queue(false);
+        queue.push(r::message_ptr_t(message).detach());
+        CHECK(message->is_shared());
+        r::message_base_t *ptr = nullptr;
+        REQUIRE(queue.pop(ptr));
+        CHECK(ptr == message.get());
+        intrusive_ptr_release(ptr);
+        CHECK(message->use_count() == 1);
+    }
+
+    SECTION("original message of handler call is shared") {
+        auto orig = make_message(1);
+        using call_t = r::message_t<r::payload::handler_call_t>;
+        auto call = r::message_ptr_t(new call_t(r::address_ptr_t(), orig, r::handler_ptr_t()));
+        CHECK(!orig->is_shared());
+        call->share();
+        CHECK(call->is_shared());
+        CHECK(orig->is_shared());
+    }
+
+    SECTION("request of response is shared") {
+        using traits_t = r::request_traits_t<hybrid::request_t>;
+        using request_message_t = traits_t::request::message_t;
+        using response_message_t = traits_t::response::message_t;
+        auto addr = r::address_ptr_t();
+        auto req = traits_t::request::message_ptr_t(new request_message_t(addr, r::request_id_t{1}, addr, addr, 5));
+        auto ee = r::extended_error_ptr_t();
+        auto res = r::message_ptr_t(new response_message_t(addr, req, ee, hybrid::response_t{50}));
+        CHECK(!req->is_shared());
+        r::inbound_queue_t queue(true);
+        queue.push(r::message_ptr_t(res).detach());
+        CHECK(res->is_shared());
+        CHECK(req->is_shared());
+    }
+
+    SECTION("requests of extended errors chain are shared") {
+        using traits_t = r::request_traits_t<hybrid::request_t>;
+        using request_message_t = traits_t::request::message_t;
+        using response_message_t = traits_t::response::message_t;
+        auto addr = r::address_ptr_t();
+        auto make_request = [&](r::request_id_t id) {
+            return traits_t::request::message_ptr_t(new request_message_t(addr, id, addr, addr, 5));
+        };
+        auto ec = r::make_error_code(r::error_code_t::request_timeout);
+        auto inner_req = make_request(1);
+        auto outer_req = make_request(2);
+        auto inner = r::make_error("inner", ec, {}, inner_req);
+        auto outer = r::make_error("outer", ec, inner, outer_req);
+
+        SECTION("shutdown trigger") {
+            using trigger_t = r::message_t<r::payload::shutdown_trigger_t>;
+            auto message = r::message_ptr_t(new trigger_t(addr, addr, outer));
+            message->share();
+        }
+        SECTION("shutdown request") {
+            using request_t = r::message::shutdown_request_t;
+            auto message = r::message_ptr_t(new request_t(addr, r::request_id_t{3}, addr, addr, outer));
+            message->share();
+        }
+        SECTION("error response") {
+            auto req = make_request(4);
+            auto message = r::message_ptr_t(new response_message_t(addr, outer, req));
+            message->share();
+            CHECK(req->is_shared());
+        }
+        CHECK(outer_req->is_shared());
+        CHECK(inner_req->is_shared());
+    }
+}
+#endif
+
+TEST_CASE("request slots", "[misc]") {
+    using slots_t = r::request_slots_t;
+    slots_t slots;
+    CHECK(slots.empty());
+    CHECK(!slots.find(1));
+    CHECK(!slots.find(slots_t::request_bit));
+
+    auto &slot_1 = slots.acquire();
+    auto id_1 = slot_1.timer.request_id;
+    CHECK(slots_t::is_request(id_1));
+    CHECK(slots.find(id_1) == &slot_1);
+    CHECK(slots.size() == 1);
+
+    SECTION("stale id does not match reused slot") {
+        slots.release(slot_1);
+        CHECK(slots.empty());
+        CHECK(!slots.find(id_1));
+
+        auto &slot_2 = slots.acquire();
+        auto id_2 = slot_2.timer.request_id;
+        CHECK(&slot_2 == &slot_1);
+        CHECK(id_2 != id_1);
+        CHECK(!slots.find(id_1));
+        CHECK(slots.find(id_2) == &slot_2);
+        slots.release(slot_2);
+    }
+
+    SECTION("slots are stable, when slab grows") {
+        std::vector<r::request_slot_t *> acquired;
+        for (std::size_t i = 0; i < slots_t::chunk_size * 2; ++i) {
+            acquired.emplace_back(&slots.acquire());
+        }
+        CHECK(slots.size() == slots_t::chunk_size * 2 + 1);
+        CHECK(slots.find(id_1) == &slot_1);
+
+        r::request_list_t list;
+        list.push(*acquired[0]);
+        list.push(*acquired[1]);
+        list.push(*acquired[2]);
+        list.remove(*acquired[1]);
+        CHECK(list.front() == acquired[2]->timer.request_id);
+        list.remove(*acquired[2]);
+        CHECK(list.front() == acquired[0]->timer.request_id);
+        list.remove(*acquired[0]);
+        CHECK(list.empty());
+
+        for (auto slot : acquired) {
+            CHECK(slots.find(slot->timer.request_id) == slot);
+            slots.release(*slot);
+        }
+        slots.release(slot_1);
+    }
+    CHECK(slots.empty());
+}
+
+TEST_CASE("message type ids", "[misc]") {
+    using ping_t = r::message_t<int>;
+    using pong_t = r::message_t<double>;
+
+    CHECK(ping_t::message_type_id);
+    CHECK(pong_t::message_type_id);
+    CHECK(ping_t::message_type_id != pong_t::message_type_id);
+    CHECK(ping_t::message_type_id < r::message_support::type_ids_bound());
+    CHECK(pong_t::message_type_id < r::message_support::type_ids_bound());
+    CHECK(r::message_support::register_type_id(typeid(ping_t)) == ping_t::message_type_id);
+
+    auto message = ping_t(r::address_ptr_t{}, 5);
+    CHECK(message.type_id == ping_t::message_type_id);
+    CHECK(message.type_index == ping_t::message_type);
+}
@@ -95,6 +95,80 @@ TEST_CASE("ping/pong ", "[supervisor][asio]") {
     ponger.reset();
 
     io_context.run();
-    CHECK(sup->get_timers_map().size() == 0);
+    CHECK(sup->get_timers().empty());
     CHECK(destroyed == 4);
 }
+
+TEST_CASE("ping/pong on executor", "[supervisor][asio]") {
+    using executor_t = ra::supervisor_config_asio_t::executor_t;
+    asio::io_context io_context{1};
+    auto system_context = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_context)};
+    auto executor = std::shared_ptr<executor_t>();
+    SECTION("io_context executor") { executor = std::make_shared<executor_t>(io_context.get_executor()); }
+    SECTION("strand executor") { executor = std::make_shared<executor_t>(asio::make_strand(io_context)); }
+
+    auto timeout = r::pt::milliseconds{10};
+    auto sup =
+        system_context->create_supervisor<rt::supervisor_asio_test_t>().timeout(timeout).executor(executor).finish();
+
+    auto pinger = sup->create_actor<pinger_t>().timeout(timeout).autoshutdown_supervisor().finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(timeout).finish();
+    pinger->set_ponger_addr(static_cast<r::actor_base_t *>(ponger.get())->get_address());
+    ponger->set_pinger_addr(static_cast<r::actor_base_t *>(pinger.get())->get_address());
+
+    sup->start();
+    io_context.run();
+
+    REQUIRE(pinger->ping_sent == 1);
+    REQUIRE(pinger->pong_received == 1);
+    REQUIRE(ponger->pong_sent == 1);
+    REQUIRE(ponger->ping_received == 1);
+
+    REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+    CHECK(sup->get_timers().empty());
+    CHECK(!sup->is_wakeup_pending());
+}
+
+struct counter_t : public r::actor_base_t {
+    std::uint32_t received = 0;
+
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&counter_t::on_ping); });
+    }
+
+    void on_ping(rotor::message_t<ping_t> &) noexcept { ++received; }
+};
+
+TEST_CASE("coalesced wakeups", "[supervisor][asio]") {
+    asio::io_context io_context{1};
+    auto system_context = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_context)};
+    auto strand = std::make_shared<asio::io_context::strand>(io_context);
+    auto timeout = r::pt::milliseconds{10};
+    auto sup = system_context->create_supervisor<rt::supervisor_asio_test_t>().timeout(timeout).strand(strand).finish();
+    auto counter = sup->create_actor<counter_t>().timeout(timeout).finish();
+
+    sup->start();
+    io_context.poll();
+    REQUIRE(static_cast<r::actor_base_t *>(counter.get())->access<rt::to::state>() == r::state_t::OPERATIONAL);
+    CHECK(!sup->is_wakeup_pending());
+
+    auto &address = static_cast<r::actor_base_t *>(counter.get())->get_address();
+    for (int i = 0; i < 3; ++i) {
+        sup->enqueue(r::make_message<ping_t>(address));
+        CHECK(sup->is_wakeup_pending());
+    }
+    io_context.restart();
+    io_context.poll();
+    CHECK(counter->received == 3);
+    CHECK(!sup->is_wakeup_pending());
+
+    sup->shutdown();
+    io_context.restart();
+    io_context.run();
+    REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
@@ -7,6 +7,7 @@
 #include "rotor.hpp"
 #include "rotor/asio.hpp"
 #include "supervisor_asio_test.h"
+#include "timer_test_fixture.h"
 #include "access.h"
 
 namespace r = rotor;
@@ -105,3 +106,27 @@ TEST_CASE("zero timeout", "[supervisor][asio]") {
     REQUIRE(sup->get_leader_queue().size() == 0);
     CHECK(rt::empty(sup->get_subscription()));
 }
+
+TEST_CASE("multiplexed timers", "[supervisor][asio]") {
+    using executor_t = ra::supervisor_config_asio_t::executor_t;
+    asio::io_context io_context{1};
+    auto timeout = r::pt::milliseconds{10};
+    auto system_context = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_context)};
+    auto executor = std::make_shared<executor_t>(io_context.get_executor());
+
+    auto sup =
+        system_context->create_supervisor<rt::supervisor_asio_test_t>().executor(executor).timeout(timeout).finish();
+    auto actor = sup->create_actor<rt::multi_timer_actor_t>().timeout(timeout).autoshutdown_supervisor().finish();
+
+    auto started = std::chrono::steady_clock::now();
+    sup->start();
+    io_context.run();
+    auto finished = std::chrono::steady_clock::now();
+
+    actor->check(started, finished);
+    CHECK(sup->get_timers().empty());
+
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
@@ -8,6 +8,7 @@
 #include "rotor.hpp"
 #include "rotor/ev.hpp"
 #include "access.h"
+#include "timer_test_fixture.h"
 #include <ev.h>
 #include <boost/asio/detail/winsock_init.hpp> // for calling WSAStartup on Windows
 
@@ -65,3 +66,23 @@ TEST_CASE("timer", "[supervisor][ev]") {
     REQUIRE(actor->ee->ec == r::error_code_t::request_timeout);
     REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
 }
+
+TEST_CASE("multiplexed timers", "[supervisor][ev]") {
+    auto *loop = ev_loop_new(0);
+    auto system_context = r::intrusive_ptr_t<re::system_context_ev_t>{new re::system_context_ev_t()};
+    auto timeout = r::pt::milliseconds{10};
+    auto sup = system_context->create_supervisor<re::supervisor_ev_t>()
+                   .loop(loop)
+                   .timeout(timeout)
+                   .loop_ownership(true)
+                   .finish();
+    auto actor = sup->create_actor<rt::multi_timer_actor_t>().timeout(timeout).finish();
+
+    auto started = std::chrono::steady_clock::now();
+    sup->start();
+    ev_run(loop);
+    auto finished = std::chrono::steady_clock::now();
+
+    actor->check(started, finished);
+    REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
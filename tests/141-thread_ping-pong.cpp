@@ -8,6 +8,9 @@
 #include "rotor.hpp"
 #include "rotor/thread.hpp"
 #include "access.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace r = rotor;
 namespace rth = rotor::thread;
@@ -116,6 +119,49 @@ struct ponger_t : public r::actor_base_t {
     }
 };
 
+struct counter_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::uint32_t expected = 0;
+    std::uint32_t received = 0;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&counter_t::on_ping); });
+    }
+
+    void on_ping(rotor::message_t<ping_t> &) noexcept {
+        if (++received == expected) {
+            supervisor->shutdown();
+        }
+    }
+};
+
+#if defined(ROTOR_REFCOUNT_HYBRID)
+struct share_checker_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::vector<bool> shared;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&share_checker_t::on_ping); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        send<ping_t>(get_address());
+    }
+
+    void on_ping(rotor::message_t<ping_t> &msg) noexcept {
+        shared.emplace_back(msg.is_shared());
+        if (shared.size() == 2) {
+            supervisor->shutdown();
+        }
+    }
+};
+#endif
+
 struct bad_actor_t : public r::actor_base_t {
     using r::actor_base_t::actor_base_t;
 
@@ -191,3 +237,112 @@ TEST_CASE("supervisors hierarchy", "[supervisor][thread]") {
     CHECK(((r::actor_base_t *)act.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
     CHECK(((r::actor_base_t *)sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
 }
+
+#if !defined(ROTOR_REFCOUNT_THREADUNSAFE)
+TEST_CASE("multiple producers, sleeping consumer", "[supervisor][thread]") {
+    static constexpr std::uint32_t producers = 4;
+    static constexpr std::uint32_t count = 1000;
+
+    auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t());
+    auto timeout = r::pt::milliseconds{10};
+    auto sup = system_context->create_supervisor<rth::supervisor_thread_t>()
+                   .poll_duration(r::pt::microseconds{0})
+                   .timeout(timeout)
+                   .finish();
+    auto counter = sup->create_actor<counter_t>().timeout(timeout).finish();
+    counter->expected = producers * count;
+    sup->do_process();
+
+    auto address = counter->get_address();
+    auto threads = std::vector<std::thread>();
+    for (std::uint32_t i = 0; i < producers; ++i) {
+        threads.emplace_back([&]() {
+            for (std::uint32_t j = 0; j < count; ++j) {
+                sup->enqueue(r::make_message<ping_t>(address));
+                if (j % 100 == 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds{100});
+                }
+            }
+        });
+    }
+    system_context->run();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    CHECK(counter->received == producers * count);
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("pooled messages are released on other threads while the supervisor is destroyed", "[supervisor][thread]") {
+    static constexpr int iterations = 200;
+    static constexpr int releasers = 4;
+    static constexpr int count = 64;
+
+    for (int i = 0; i < iterations; ++i) {
+        auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t());
+        auto timeout = r::pt::milliseconds{10};
+        auto sup = system_context->create_supervisor<rth::supervisor_thread_t>()
+                       .pool_messages()
+                       .timeout(timeout)
+                       .finish();
+        sup->do_process();
+        auto pool = sup->access<rt::to::message_pool>().get();
+        REQUIRE(pool);
+
+        auto batches = std::vector<std::vector<r::message_ptr_t>>(releasers);
+        for (auto &batch : batches) {
+            for (int j = 0; j < count; ++j) {
+                auto message = r::make_pooled_message<ping_t>(pool, sup->get_address());
+                REQUIRE(message->pool == pool);
+                message->share();
+                batch.emplace_back(std::move(message));
+            }
+        }
+
+        auto started = std::atomic_int{0};
+        auto threads = std::vector<std::thread>();
+        for (auto &batch : batches) {
+            threads.emplace_back([&started, &batch]() {
+                ++started;
+                while (started.load() <= releasers) {
+                    std::this_thread::yield();
+                }
+                for (auto &message : batch) {
+                    message.reset();
+                }
+            });
+        }
+        ++started;
+        sup->do_shutdown();
+        system_context->run();
+        CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+        sup.reset();
+        system_context.reset();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+}
+#endif
+
+#if defined(ROTOR_REFCOUNT_HYBRID)
+TEST_CASE("hybrid refcount: only enqueued from other thread messages are shared", "[supervisor][thread]") {
+    auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t());
+    auto timeout = r::pt::milliseconds{10};
+    auto sup = system_context->create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto checker = sup->create_actor<share_checker_t>().timeout(timeout).finish();
+    sup->do_process();
+    REQUIRE(checker->shared == std::vector<bool>{false});
+
+    auto message = r::make_message<ping_t>(checker->get_address());
+    CHECK(!message->is_shared());
+    auto thread = std::thread([&]() { sup->enqueue(message); });
+    thread.join();
+    CHECK(message->is_shared());
+
+    system_context->run();
+    CHECK(checker->shared == std::vector<bool>{false, true});
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
+#endif
@@ -8,6 +8,9 @@
 #include "rotor.hpp"
 #include "rotor/thread.hpp"
 #include "access.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace r = rotor;
 namespace rth = rotor::thread;
@@ -228,3 +231,61 @@ TEST_CASE("has I/O tag, correct timers", "[supervisor][thread]") {
     REQUIRE(actor->ee->ec == r::error_code_t::request_timeout);
     REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
 }
+
+struct dummy_timer_t : r::timer_handler_base_t {
+    using r::timer_handler_base_t::timer_handler_base_t;
+    void trigger(bool) noexcept override {}
+};
+
+TEST_CASE("timer wheel", "[thread]") {
+    using wheel_t = r::timer_wheel_t;
+    using ms_t = std::chrono::milliseconds;
+    auto origin = wheel_t::clock_t::now();
+    auto wheel = wheel_t(origin);
+    CHECK(wheel.empty());
+    CHECK(wheel.next_deadline() == wheel_t::clock_t::time_point::max());
+
+    // deadlines (ms) cover all levels & overflow
+    auto delays = std::vector<std::int64_t>{0, 1, 5, 63, 64, 65, 100, 4095, 4096, 5000, 262143, 262144, 300000,
+                                            16777215, 16777216, 20000000, 70000000};
+    auto timers = std::vector<std::unique_ptr<dummy_timer_t>>();
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        timers.emplace_back(new dummy_timer_t(nullptr, static_cast<r::request_id_t>(i)));
+        wheel.start(*timers.back(), origin + ms_t(delays[i]) + std::chrono::microseconds(10));
+    }
+    auto cancelled = std::vector<std::size_t>{2, 8, 16};
+    for (auto i : cancelled) {
+        CHECK(wheel.cancel(*timers[i]));
+        CHECK(timers[i]->wheel_link.slot == r::timer_link_t::detached);
+    }
+    CHECK(!wheel.cancel(*timers[2]));
+    CHECK(wheel.size() == delays.size() - cancelled.size());
+
+    std::size_t expired = 0;
+    auto now = origin;
+    auto last = std::int64_t{-1};
+    while (!wheel.empty()) {
+        auto next = wheel.next_deadline();
+        REQUIRE(next != wheel_t::clock_t::time_point::max());
+        REQUIRE(next >= now);
+        now = next;
+        while (auto handler = wheel.pop_expired(now)) {
+            auto i = static_cast<std::size_t>(handler->request_id);
+            CHECK(handler->wheel_link.slot == r::timer_link_t::detached);
+            CHECK(std::find(cancelled.begin(), cancelled.end(), i) == cancelled.end());
+            auto fired_at = std::chrono::duration_cast<ms_t>(now - origin).count();
+            CHECK(fired_at == delays[i] + 1);
+            CHECK(delays[i] > last);
+            last = delays[i];
+            ++expired;
+        }
+    }
+    CHECK(expired == delays.size() - cancelled.size());
+
+    SECTION("timer started in the past expires on the next tick") {
+        timers.emplace_back(new dummy_timer_t(nullptr, r::request_id_t{100}));
+        wheel.start(*timers.back(), origin);
+        CHECK(!wheel.pop_expired(now));
+        CHECK(wheel.pop_expired(now + ms_t(1)) == timers.back().get());
+    }
+}
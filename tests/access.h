@@ -21,6 +21,7 @@ struct internal_infos {};
 struct mine_handlers {};
 struct actors_map {};
 struct points {};
+struct points_index {};
 struct locality_leader {};
 struct parent_supervisor {};
 struct supervisor {};
@@ -28,7 +29,6 @@ struct registry {};
 struct queue {};
 struct inbound_queue {};
 struct own_subscriptions {};
-struct request_map {};
 struct resources {};
 struct last_req_id {};
 struct promises {};
@@ -36,6 +36,8 @@ struct discovery_map {};
 struct forget_link {};
 struct tag {};
 struct timers_map {};
+struct pinned_addresses {};
+struct message_pool {};
 } // namespace to
 } // namespace
 
@@ -72,15 +74,19 @@ template <> inline auto &rotor::plugin::plugin_base_t::access<test::to::own_subs
 }
 template <> inline auto &plugin::child_manager_plugin_t::access<test::to::actors_map>() noexcept { return actors_map; }
 template <> inline auto &plugin::lifetime_plugin_t::access<test::to::points>() noexcept { return points; }
+template <> inline auto &plugin::lifetime_plugin_t::access<test::to::points_index>() noexcept { return points_index; }
 template <> inline auto &plugin::resources_plugin_t::access<test::to::resources>() noexcept { return resources; }
 template <> inline auto &plugin::registry_plugin_t::access<test::to::discovery_map>() noexcept { return discovery_map; }
 
 template <> inline auto &rotor::supervisor_t::access<test::to::locality_leader>() noexcept { return locality_leader; }
+template <> inline auto &rotor::system_context_t::access<test::to::pinned_addresses>() noexcept {
+    return pinned_addresses;
+}
+template <> inline auto &rotor::supervisor_t::access<test::to::message_pool>() noexcept { return message_pool; }
 template <> inline auto &rotor::supervisor_t::access<test::to::parent_supervisor>() noexcept { return parent; }
 template <> inline auto &rotor::supervisor_t::access<test::to::registry>() noexcept { return registry_address; }
 template <> inline auto &rotor::supervisor_t::access<test::to::queue>() noexcept { return queue; }
 template <> inline auto &rotor::supervisor_t::access<test::to::inbound_queue>() noexcept { return inbound_queue; }
-template <> inline auto &rotor::supervisor_t::access<test::to::request_map>() noexcept { return request_map; }
 template <> inline auto &rotor::supervisor_t::access<test::to::last_req_id>() noexcept { return last_req_id; }
 template <> inline auto &rotor::registry_t::access<test::to::promises>() noexcept { return promises; }
 template <> inline auto &rotor::system_context_t::access<test::to::supervisor>() noexcept { return supervisor; }
@@ -23,6 +23,7 @@ void actor_test_t::force_cleanup() noexcept {
         plugin->access<to::own_subscriptions>().clear();
     }
     lifetime->access<to::points>().clear();
+    lifetime->access<to::points_index>().clear();
 }
 
 void actor_test_t::shutdown_finish() noexcept {
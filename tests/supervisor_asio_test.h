@@ -15,11 +15,13 @@ namespace test {
 struct supervisor_asio_test_t : public rotor::asio::supervisor_asio_t {
     using rotor::asio::supervisor_asio_t::supervisor_asio_t;
 
-    timers_map_t &get_timers_map() noexcept { return timers_map; }
+    timer_wheel_t &get_timers() noexcept { return timers; }
     state_t &get_state() noexcept { return state; }
     auto &get_leader_queue() { return access<to::locality_leader>()->access<to::queue>(); }
 
     subscription_t &get_subscription() noexcept { return subscription_map; }
+
+    bool is_wakeup_pending() const noexcept { return wakeup_pending.load(); }
 };
 
 } // namespace test
@@ -32,7 +32,8 @@ void supervisor_test_t::do_start_timer(const pt::time_duration &, timer_handler_
     active_timers.emplace_back(&handler);
 }
 
-void supervisor_test_t::do_cancel_timer(request_id_t timer_id) noexcept {
+void supervisor_test_t::do_cancel_timer(timer_handler_base_t &timer) noexcept {
+    auto timer_id = timer.request_id;
     printf("cancelling timer %zu (%p)\n", timer_id, (void *)this);
     auto it = active_timers.begin();
     while (it != active_timers.end()) {
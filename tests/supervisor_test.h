@@ -37,7 +37,7 @@ struct supervisor_test_t : public supervisor_t {
 
     void configure(plugin::plugin_base_t &plugin) noexcept override;
     virtual void do_start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept override;
-    virtual void do_cancel_timer(request_id_t timer_id) noexcept override;
+    virtual void do_cancel_timer(timer_handler_base_t &handler) noexcept override;
     void do_invoke_timer(request_id_t timer_id) noexcept;
     request_id_t get_timer(std::size_t index) noexcept;
     virtual void start() noexcept override {}
@@ -45,6 +45,7 @@ struct supervisor_test_t : public supervisor_t {
     virtual void enqueue(rotor::message_ptr_t message) noexcept override;
     virtual address_ptr_t make_address() noexcept override;
     void intercept(message_ptr_t &message, const void *tag, const continuation_t &continuation) noexcept override;
+    clock_t::time_point now() noexcept override { return current_time; }
 
     state_t &get_state() noexcept { return state; }
     messages_queue_t &get_leader_queue() { return get_leader().queue; }
@@ -52,7 +53,7 @@ struct supervisor_test_t : public supervisor_t {
     subscription_container_t &get_points() noexcept;
     subscription_t &get_subscription() noexcept { return subscription_map; }
     size_t get_children_count() noexcept;
-    request_map_t &get_requests() noexcept { return request_map; }
+    request_slots_t &get_requests() noexcept { return get_leader().request_slots; }
 
     auto get_activating_plugins() noexcept { return this->activating_plugins; }
     auto get_deactivating_plugins() noexcept { return this->deactivating_plugins; }
@@ -68,6 +69,7 @@ struct supervisor_test_t : public supervisor_t {
 
     const void *locality;
     timers_t active_timers;
+    clock_t::time_point current_time;
     plugin_configurer_t configurer;
     interceptor_t interceptor;
 };
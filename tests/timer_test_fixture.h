@@ -0,0 +1,62 @@
+#pragma once
+
+//
+// Copyright (c) 2026 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <catch2/catch_test_macros.hpp>
+#include "rotor/actor_base.h"
+#include <chrono>
+#include <vector>
+
+namespace rotor {
+namespace test {
+
+/** \brief starts several timers with different deadlines (and cancels some of them),
+ * shuts the supervisor down after the 3 non-cancelled ones are triggered */
+struct multi_timer_actor_t : actor_base_t {
+    using clock_t = std::chrono::steady_clock;
+    using actor_base_t::actor_base_t;
+
+    void on_start() noexcept override {
+        actor_base_t::on_start();
+        start_timer(pt::milliseconds(30), *this, &multi_timer_actor_t::on_timer);
+        start_timer(pt::milliseconds(5), *this, &multi_timer_actor_t::on_timer);
+        auto id = start_timer(pt::milliseconds(15), *this, &multi_timer_actor_t::on_timer);
+        cancel_timer(id);
+        start_timer(pt::milliseconds(10), *this, &multi_timer_actor_t::on_timer);
+        start_timer(pt::minutes(1), *this, &multi_timer_actor_t::on_timer); // to be cancelled
+    }
+
+    void on_timer(request_id_t, bool cancelled) noexcept {
+        if (cancelled) {
+            ++cancelled_count;
+            return;
+        }
+        triggered.emplace_back(clock_t::now());
+        if (triggered.size() == 3) {
+            supervisor->do_shutdown();
+        }
+    }
+
+    /** \brief checks the triggering order and deadlines, given the time points of the loop run */
+    void check(const clock_t::time_point &started, const clock_t::time_point &finished) const {
+        REQUIRE(triggered.size() == 3);
+        CHECK(cancelled_count == 2);
+        CHECK(triggered[0] - started >= std::chrono::milliseconds(5));
+        CHECK(triggered[1] - started >= std::chrono::milliseconds(10));
+        CHECK(triggered[2] - started >= std::chrono::milliseconds(30));
+        CHECK(triggered[0] <= triggered[1]);
+        CHECK(triggered[1] <= triggered[2]);
+        // the loop is not kept busy by the cancelled 1-minute timer
+        CHECK(finished - started < std::chrono::seconds(30));
+    }
+
+    std::vector<clock_t::time_point> triggered;
+    int cancelled_count = 0;
+};
+
+} // namespace test
+} // namespace rotor